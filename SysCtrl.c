@@ -1,369 +1,2557 @@
-/******************************************************************************
- *
- * Module: System Control
- *
- * File Name: SysCtrl.c
- *
- * Description:
- * System control configures the overall operation of the device and provides information about the
- * device. Configurable features include reset control, NMI operation, power control, clock control, and low-power modes.
- *
- * Author: Sayed Mohsen
- *
- *******************************************************************************/
-#include "SysCtrl.h"
-#include "SysCtrl_map.h" 
-
-
-/*OSC Predefined Clocks*/
-#define PLL_CLOCK_400 (400000000UL)
-#define PLL_CLOCK_200 (200000000UL)
-#define PIOSC       (16000000UL) /* Internal oscillator freq */
-#define PIOSC_DIV_4  (4000000UL) /* Internal oscillator freq divided by 4 */
-#define LFIOSC     (30000UL)  /* Internal 30K oscillator freq */
-#define XTAL32K     (32768UL) /* external 32K oscillator freq */
-#define MOSC_CLOCK (16000000UL)
-
-
-/**********************************************************************************************************************
- *  GLOBAL DATA
- *********************************************************************************************************************/
-
-/*global Variable To Hold Module Status */
-//static SysCtrl_statusType g_sysCtrlStatus = SYSCTRL_NOT_INITIALIZED;
-
-/*global Variable To Hold System Control Configurations */
-static const SysCtrl_configType *g_sysCtrlConfigurations = (void *)0;
-
-/*The main oscillator supports the use of a select number of crystals from 4 to 25 MHz */
-static const unsigned long g_mainOscillatorAttachedCrystal[21] =
-	{
-		SYSCTL_RCC_XTAL_4MHZ,
-		SYSCTL_RCC_XTAL_4_09MHZ,
-		SYSCTL_RCC_XTAL_4_91MHZ,
-		SYSCTL_RCC_XTAL_5MHZ,
-		SYSCTL_RCC_XTAL_5_12MHZ,
-		SYSCTL_RCC_XTAL_6MHZ,
-		SYSCTL_RCC_XTAL_6_14MHZ,
-		SYSCTL_RCC_XTAL_7_37MHZ,
-		SYSCTL_RCC_XTAL_8MHZ,
-		SYSCTL_RCC_XTAL_8_19MHZ,
-		SYSCTL_RCC_XTAL_10MHZ,
-		SYSCTL_RCC_XTAL_12MHZ,
-		SYSCTL_RCC_XTAL_12_2MHZ,
-		SYSCTL_RCC_XTAL_13_5MHZ,
-		SYSCTL_RCC_XTAL_14_3MHZ,
-		SYSCTL_RCC_XTAL_16MHZ,
-		SYSCTL_RCC_XTAL_16_3MHZ,
-		SYSCTL_RCC_XTAL_18MHZ,
-		SYSCTL_RCC_XTAL_20MHZ,
-		SYSCTL_RCC_XTAL_24MHZ,
-		SYSCTL_RCC_XTAL_25MHZ,
-};
-
-static const unsigned long g_RcgPreiphralOfsset[16] =
-{
- SYSCTL_RCGCWD_R_OFFSET ,         
- SYSCTL_RCGCTIMER_R_OFFSET ,      
- SYSCTL_RCGCGPIO_R_OFFSET ,       
- SYSCTL_RCGCDMA_R_OFFSET ,        
- SYSCTL_RCGCHIB_R_OFFSET ,        
- SYSCTL_RCGCUART_R_OFFSET ,       
- SYSCTL_RCGCSSI_R_OFFSET ,        
- SYSCTL_RCGCI2C_R_OFFSET ,        
- SYSCTL_RCGCUSB_R_OFFSET ,        
- SYSCTL_RCGCCAN_R_OFFSET ,        
- SYSCTL_RCGCADC_R_OFFSET ,        
- SYSCTL_RCGCACMP_R_OFFSET ,       
- SYSCTL_RCGCPWM_R_OFFSET ,        
- SYSCTL_RCGCQEI_R_OFFSET ,        
- SYSCTL_RCGCEEPROM_R_OFFSET ,     
- SYSCTL_RCGCWTIMER_R_OFFSET      
-};
-/**********************************************************************************************************************
-*  LOCAL FUNCTION
-*********************************************************************************************************************/
-static SysCtrl_systemClock SysCtrl_getOscillatorClock(SysCtrl_ClockSourceType clocksource, SysCtrl_ExternalCrystalValueType xtal);
-static SysCtrl_systemClock SysCtrl_getXTALClock(SysCtrl_ExternalCrystalValueType attachedCrystal);
-
-
-/******************************************************************************
-* \Syntax          :void SysCtrl_initPLL(SysCtrl_pllFreqType pllFreq, SysCtrl_systemClock requiredBusClock)       
-* \Description     : Function To Init Phase Locked Loop Module                                    
-*                                                                             
-* \Sync\Async      : Synchronous                                               
-* \Reentrancy      : Reentrant                                             
-* \Parameters (in) : pllFreq -> Determine To Use  Pll Divisor "PLL_200MHZ" OR not PLL_400MHZ
-									 : requiredBusClock -> desired bus clock To the System 
-* \Parameters (out): None                                                                                   
-*******************************************************************************/
-void SysCtrl_initPLL(SysCtrl_pllFreqType pllFreq, SysCtrl_systemClock requiredBusClock)
-{
-	SysCtrl_systemClock oscClock;
-	SysCtrl_systemDivType div;
-
-	/*bypass PLL while initializing*/
-	SYSCTL_RCC2_R |= (1 << BYPASS2); /*The system clock is derived from the OSC source*/
-
-	/*Activate PLL*/
-	SYSCTL_RCC2_R &= ~(1 << PWRDN2);
-
-	if (PLL_200MHZ == pllFreq)
-	{
-		SYSCTL_RCC2_R |= (1 << DIV400); /*Enable PLL Divisor */
-		oscClock = PLL_CLOCK_200;
-	}
-
-	else if (PLL_400MHZ == pllFreq)
-	{
-		SYSCTL_RCC2_R &= ~(1 << DIV400); /*Disable PLL Divisor */
-		oscClock = PLL_CLOCK_400;
-	}
-
-	/*Set system clock divisor.*/
-	div = (oscClock / requiredBusClock) - 1;
-	SYSCTL_RCC2_R = (SYSCTL_RCC2_R & 0xE03FFFFF) | (div << 22);
-
-	/*wait PLL to lock.*/
-	while ((SYSCTL_RIS_R & (1 << PLLLRIS)) == 0); /* wait for PLLRIS bit */
-
-	/* select PLL as the source of system clock*/
-	SYSCTL_RCC2_R &= ~(1 << BYPASS2); /* remove bypass and use the PLL */
-}
-
-/******************************************************************************
-* \Syntax          :void SysCtrl_initSystemClock(const SysCtrl_configType *config_ptr)     
-* \Description     : Function To Init System Bus Clock                                                                                             
-* \Sync\Async      : Synchronous                                               
-* \Reentrancy      : non Reentrant                                             
-* \Parameters (in) : config_ptr -> configure System Bus Clock
-* \Parameters (out): None                                                                                   
-*******************************************************************************/
-
-void SysCtrl_initSystemClock(const SysCtrl_configType *config_ptr)
-{
-	SysCtrl_systemClock sysClock = PIOSC;
-	SysCtrl_systemDivType div;
-	
-	/* check if the input configuration pointer is not a NULL_PTR */
-	if (config_ptr != (void *)0)
-	{
-		/*Save Clock Configurations*/
-		g_sysCtrlConfigurations = config_ptr;
-
-		/*initilization Sequence*/
-
-		/*Use RCC2 To Extend RCC Functions*/
-		SYSCTL_RCC2_R |= SYSCTL_RCC2_USERCC2; /*Writing in RCC2 Overrides RCC*/
-
-		/*Set oscillator source Clock */
-		SYSCTL_RCC2_R = (SYSCTL_RCC2_R & 0xFFFFFF8F) | (g_sysCtrlConfigurations->clocksource << 4);
-
-		if (PLL_OPERATING_NORMALLY == g_sysCtrlConfigurations->plluse)
-		{
-			/*init PLL */
-			SysCtrl_initPLL(g_sysCtrlConfigurations->pll, g_sysCtrlConfigurations->desiredClock);
-		}
-		else if (PLL_POWERED_DOWM == g_sysCtrlConfigurations->plluse)
-		{
-			/*MOSC Setup */
-			if (CLOCK_SOURCE_MAIN_OSCILLATOR == g_sysCtrlConfigurations->clocksource)
-			{
-				/*Set external crystal value XTAL*/
-				SYSCTL_RCC_R &= ~SYSCTL_RCC_XTAL_M; /*Clear Attached Crystal Value*/
-				SYSCTL_RCC_R |= g_mainOscillatorAttachedCrystal[g_sysCtrlConfigurations->xtal];
-
-				/*Enable Main Oscillator*/
-				SYSCTL_RCC_R &= ~(1 << MOSCDIS);
-			}
-
-			/*Get Oscillator Clock*/
-			sysClock = SysCtrl_getOscillatorClock(g_sysCtrlConfigurations->clocksource, g_sysCtrlConfigurations->xtal);
-
-			/*Set system clock divisor.*/
-			div = (sysClock / g_sysCtrlConfigurations->desiredClock) - 1;
-			SYSCTL_RCC2_R = (SYSCTL_RCC2_R & 0xE03FFFFF) | (div << 22);
-		}
-	}
-}
-
-
-/******************************************************************************
-* \Syntax          :SysCtrl_resetCauseType SysCtrl_getResetCause (void)     
-* \Description     : Detecet a reset cause since the previous power-on reset.                                                                                             
-* \Sync\Async      : Synchronous                                               
-* \Reentrancy      : non Reentrant                                             
-* \Parameters (in) : None
-* \Parameters (out): reset Cause                                                                                   
-*******************************************************************************/
-SysCtrl_resetCauseType SysCtrl_getResetCause (void)
-{
-	/*Read Reset Cause */
-	SysCtrl_resetCauseType resetCause = SYSCTL_RESC_R ; 
-	
-	/*Clear Reset Cause*/
-	SYSCTL_RESC_R = 0 ; /*Writing a 0 to any reset cause clears it.*/
-	
-	/*Return Reset Cause*/
-	return resetCause ; 
-}
-
-/******************************************************************************
-* \Syntax          : SysCtrl_pllStatusType SysCtrl_getPllStatus( void ) 
-* \Description     : get Current PLL Status either "POWERED/LOCKED" OR"UNPOWERD/UNLOCKED"                                                                                              
-* \Sync\Async      : Synchronous                                               
-* \Reentrancy      : non Reentrant                                             
-* \Parameters (in) : None
-* \Parameters (out): reset Cause                                                                                   
-*******************************************************************************/
-SysCtrl_pllStatusType SysCtrl_getPllStatus( void )
-{
-	SysCtrl_pllStatusType currentPllStatus=((SYSCTL_PLLSTAT_R ==0) ? PLL_IS_UNLOCKED : PLL_IS_LOCKED); 
-	return currentPllStatus ; 
-}
-
-/******************************************************************************
-* \Syntax          : void SysCtrl_peripheralEnable(SysCtrl_systemPeriphralType periphral ,SysCtrl_periphralInstanceType instance)
-* \Description     : enable Clock Gate For Any Periphral instance                                                                                             
-* \Sync\Async      : Synchronous                                               
-* \Reentrancy      : non Reentrant                                             
-* \Parameters (in) : periphral / perphiral instance 
-* \Parameters (out): None                                                                                   
-*******************************************************************************/
-void SysCtrl_peripheralEnable(SysCtrl_systemPeriphralType periphral ,SysCtrl_periphralInstanceType instance)
-{
-	*((volatile unsigned long *)(SYSCTL_RCGCBASE+g_RcgPreiphralOfsset[periphral])) |= (1<<instance) ; 
-}
-/******************************************************************************
-* \Syntax          : void SysCtrl_peripheralDisable(SysCtrl_systemPeriphralType periphral ,SysCtrl_periphralInstanceType instance)
-* \Description     : Disable Clock Gate For Any Periphral instance                                                                                             
-* \Sync\Async      : Synchronous                                               
-* \Reentrancy      : non Reentrant                                             
-* \Parameters (in) : periphral / perphiral instance 
-* \Parameters (out): None                                                                                   
-*******************************************************************************/
-
-void SysCtrl_peripheralDisable(SysCtrl_systemPeriphralType periphral ,SysCtrl_periphralInstanceType instance)
-{
-	*((volatile unsigned long *)(SYSCTL_RCGCBASE+g_RcgPreiphralOfsset[periphral])) &= ~(1<<instance) ; 
-}
-
-/******************************************************************************
-* \Syntax          :static SysCtrl_systemClock SysCtrl_getXTALClock(SysCtrl_ExternalCrystalValueType attachedCrystal)     
-* \Description     : Function To get Attached Crystal Clock                                                                                             
-* \Sync\Async      : Synchronous                                               
-* \Reentrancy      : non Reentrant                                             
-* \Parameters (in) : attachedCrystal -> attached Crystal
-* \Parameters (out):   moscClk  -> MOSC Attached Crystal Clock Value                                                                             
-*******************************************************************************/
-
-static SysCtrl_systemClock SysCtrl_getXTALClock(SysCtrl_ExternalCrystalValueType attachedCrystal)
-{
-	SysCtrl_systemClock moscClk;
-	switch (attachedCrystal)
-	{
-
-	case XTAL_4MHZ:
-		moscClk = 4000000UL;
-		break;
-	case XTAL_4_09MHZ:
-		moscClk = 4096000UL;
-		break;
-	case XTAL_4_91MHZ:
-		moscClk = 4915200UL;
-		break;
-	case XTAL_5MHZ:
-		moscClk = 5000000UL;
-		break;
-	case XTAL_5_12MHZ:
-		moscClk = 5120000UL;
-		break;
-	case XTAL_6MHZ:
-		moscClk = 6000000UL;
-		break;
-	case XTAL_6_14MHZ:
-		moscClk = 6144000UL;
-		break;
-	case XTAL_7_37MHZ:
-		moscClk = 7372800UL;
-		break;
-	case XTAL_8MHZ:
-		moscClk = 8000000UL;
-		break;
-	case XTAL_8_19MHZ:
-		moscClk = 8192000UL;
-		break;
-	case XTAL_10MHZ:
-		moscClk = 10000000UL;
-		break;
-	case XTAL_12MHZ:
-		moscClk = 12000000UL;
-		break;
-	case XTAL_12_2MHZ:
-		moscClk = 12288000UL;
-		break;
-	case XTAL_13_5MHZ:
-		moscClk = 13560000UL;
-		break;
-	case XTAL_14_3MHZ:
-		moscClk = 14318180UL;
-		break;
-	case XTAL_16MHZ:
-		moscClk = 16000000UL;
-		break;
-	case XTAL_16_3MHZ:
-		moscClk = 16384000UL;
-		break;
-	case XTAL_18MHZ:
-		moscClk = 18000000UL;
-		break;
-	case XTAL_20MHZ:
-		moscClk = 20000000UL;
-		break;
-	case XTAL_24MHZ:
-		moscClk = 24000000UL;
-		break;
-	case XTAL_25MHZ:
-		moscClk = 25000000UL;
-		break;
-	}
-	return moscClk;
-}
-
-
-/******************************************************************************
-* \Syntax          :static SysCtrl_systemClock SysCtrl_getOscillatorClock(SysCtrl_ClockSourceType clocksource, 
-																								SysCtrl_ExternalCrystalValueType xtal)     
-* \Description     : Function To get Current OSC Clock                                                                                             
-* \Sync\Async      : Synchronous                                               
-* \Reentrancy      : non Reentrant                                             
-* \Parameters (in) : clocksource -> oscillator Clock Source
-									 :  xtal -> Attached Crystal
-* \Parameters (out):   sysClock  -> current System Clock                                                                          
-*******************************************************************************/
-static SysCtrl_systemClock SysCtrl_getOscillatorClock(SysCtrl_ClockSourceType clocksource, SysCtrl_ExternalCrystalValueType xtal)
-{
-	SysCtrl_systemClock sysClock = PIOSC;
-	switch (clocksource)
-	{
-	case CLOCK_SOURCE_MAIN_OSCILLATOR:
-		sysClock = SysCtrl_getXTALClock(xtal);
-		break;
-	case CLOCK_SOURCE_PRECISION_INTERNAL_OSCILLATOR:
-		sysClock = PIOSC;
-		break;
-	case CLOCK_SOURCE_PRECISION_INTERNAL_OSCILLATOR_DIVDED_4:
-		sysClock = PIOSC_DIV_4;
-		break;
-	case CLOCK_SOURCE_LOW_FREQUENCY_INTERNAL_OSCILLATOR:
-		sysClock = LFIOSC;
-		break;
-	case CLOCK_SOURCE_HIBERNTION_OSCILLATOR:
-		sysClock = XTAL32K;
-		break;
-	}
-	return sysClock;
-}
-/**********************************************************************************************************************
- *  END OF FILE: FileName.c
- *********************************************************************************************************************/
+/******************************************************************************
+ *
+ * Module: System Control
+ *
+ * File Name: SysCtrl.c
+ *
+ * Description:
+ * System control configures the overall operation of the device and provides information about the
+ * device. Configurable features include reset control, NMI operation, power control, clock control, and low-power modes.
+ *
+ * Author: Sayed Mohsen
+ *
+ *******************************************************************************/
+#include "SysCtrl.h"
+#include "SysCtrl_clockTree.h"
+#include "SysCtrl_map.h" 
+#include "SysCtrl_snapshot.h"
+#include "SysCtrl_trace.h"
+
+
+/*OSC Predefined Clocks*/
+#define PLL_CLOCK_400 SYSCTRL_PLL_400_HZ
+#define PLL_CLOCK_200 SYSCTRL_PLL_200_HZ
+#define PIOSC         SYSCTRL_PIOSC_HZ /* Internal oscillator freq */
+
+
+/*Run Mode Clock Gate Access*/
+#if (SYSCTRL_GATE_ACCESS == SYSCTRL_GATE_ACCESS_BITBAND)
+#define SYSCTRL_GATE_BIT_SET(offset, bit)     SYSCTL_REG_BIT_WRITE((offset), (bit), 1)
+#define SYSCTRL_GATE_BIT_CLEAR(offset, bit)   SYSCTL_REG_BIT_WRITE((offset), (bit), 0)
+#define SYSCTRL_GATE_MASK_SET(offset, mask)   SysCtrl_writeGateBits((offset), (mask), 1)
+#define SYSCTRL_GATE_MASK_CLEAR(offset, mask) SysCtrl_writeGateBits((offset), (mask), 0)
+#define SYSCTRL_GATE_MASK_WRITE(offset, clearMask, setMask) \
+	do { SysCtrl_writeGateBits((offset), (clearMask), 0); SysCtrl_writeGateBits((offset), (setMask), 1); } while (0)
+#else
+#define SYSCTRL_GATE_BIT_SET(offset, bit)     SYSCTRL_REG_MODIFY((offset), 0, (1UL << (bit)))
+#define SYSCTRL_GATE_BIT_CLEAR(offset, bit)   SYSCTRL_REG_MODIFY((offset), (1UL << (bit)), 0)
+#define SYSCTRL_GATE_MASK_SET(offset, mask)   SYSCTRL_REG_MODIFY((offset), 0, (mask))
+#define SYSCTRL_GATE_MASK_CLEAR(offset, mask) SYSCTRL_REG_MODIFY((offset), (mask), 0)
+#define SYSCTRL_GATE_MASK_WRITE(offset, clearMask, setMask) SYSCTRL_REG_MODIFY((offset), (clearMask), (setMask))
+#endif
+
+
+/*Clock And Gate Register Update .. RCC, RCC2 and RCGCx go through their RAM shadow in shadow mode.
+  STAGE changes the register image only, COMMIT writes it (without the shadow every STAGE is written at once)*/
+#if (SYSCTRL_SHADOW_REGISTERS == 1U)
+#if (SYSCTRL_GATE_ACCESS == SYSCTRL_GATE_ACCESS_BITBAND)
+#error "SYSCTRL_SHADOW_REGISTERS needs SYSCTRL_GATE_ACCESS_RMW, bit-band gate stores bypass the shadow"
+#endif
+#define SYSCTRL_REG_WRITE(offset, value)               SysCtrl_shadowModify((offset), ~0UL, (value), 1)
+#define SYSCTRL_REG_MODIFY(offset, clearMask, setMask) SysCtrl_shadowModify((offset), (clearMask), (setMask), 1)
+#define SYSCTRL_REG_STAGE(offset, clearMask, setMask)  SysCtrl_shadowModify((offset), (clearMask), (setMask), 0)
+#define SYSCTRL_REG_COMMIT(offset)                     SysCtrl_shadowModify((offset), 0, 0, 1)
+#else
+#define SYSCTRL_REG_WRITE(offset, value)               SYSCTL_REG_WRITE((offset), (value))
+#define SYSCTRL_REG_MODIFY(offset, clearMask, setMask) SYSCTL_REG_MODIFY((offset), (clearMask), (setMask))
+#define SYSCTRL_REG_STAGE(offset, clearMask, setMask)  SYSCTL_REG_MODIFY((offset), (clearMask), (setMask))
+#define SYSCTRL_REG_COMMIT(offset)                     ((void)0)
+#endif
+
+/*RCGCx Words Held In The Shadow*/
+#define SYSCTRL_SHADOW_RCGC_WORDS (0x60 / 4)
+
+
+/**********************************************************************************************************************
+ *  GLOBAL DATA
+ *********************************************************************************************************************/
+
+/*global Variable To Hold Module Status */
+//static SysCtrl_statusType g_sysCtrlStatus = SYSCTRL_NOT_INITIALIZED;
+
+/*global Variable To Hold System Control Configurations */
+static const SysCtrl_configType *g_sysCtrlConfigurations = (void *)0;
+
+/*Clock Cache .. refreshed on every clock change, served by the SysCtrl_getxxxClock queries*/
+static SysCtrl_systemClock g_sysCtrlSystemClock = PIOSC;
+static SysCtrl_systemClock g_pwmClock = PIOSC;
+static SysCtrl_systemClock g_adcClock = PIOSC;
+static SysCtrl_systemClock g_pioscClock = PIOSC;
+static SysCtrl_systemClock g_usbClock = 0;
+static SysCtrl_systemClock g_altClock = PIOSC;
+static SysCtrl_altClockSourceType g_altClockSource = SYSCTRL_ALT_CLOCK_PIOSC;
+
+/*PWM Unit Clock Divider As A Shift (0 -> Undivided System Clock)*/
+static unsigned char g_pwmDivShift = 0;
+
+/*Instances Clocked From The Alternate Clock (UARTCC/SSICC) .. one bit per instance*/
+static unsigned long g_altClockInstances[SYSCTRL_NUM_OF_PERIPHRALS];
+
+/*The main oscillator supports the use of a select number of crystals from 4 to 25 MHz */
+static const SysCtrl_systemClock g_crystalClock[21] =
+{
+	4000000UL, 4096000UL, 4915200UL, 5000000UL, 5120000UL, 6000000UL, 6144000UL,
+	7372800UL, 8000000UL, 8192000UL, 10000000UL, 12000000UL, 12288000UL, 13560000UL,
+	14318180UL, 16000000UL, 16384000UL, 18000000UL, 20000000UL, 24000000UL, 25000000UL
+};
+
+/*Clock Switch Started By SysCtrl_startSystemClock And Waiting For PLL Lock*/
+static const SysCtrl_configType * volatile g_pendingClockConfig = (void *)0;
+static SysCtrl_systemClock g_pendingClockOldClock;
+static SysCtrl_clockReadyCallbackType g_clockReadyCallback = (void *)0;
+
+/*PLL Lock Measurement*/
+static SysCtrl_pllStatsType g_pllStats;
+static unsigned long g_pllLockStart;
+static unsigned long g_pllAttemptStart;
+static unsigned char g_pllAttempt;
+
+#if (SYSCTRL_TRACE == 1U)
+/*Event Trace Ring Buffer*/
+static SysCtrl_traceBufferType g_trace = {SYSCTRL_TRACE_MAGIC, SYSCTRL_TRACE_DEPTH, 0, {{0}}};
+
+/*Build Fails When SYSCTRL_TRACE_DEPTH Is Not A Power Of Two*/
+typedef char SysCtrl_traceDepthCheck[((SYSCTRL_TRACE_DEPTH & (SYSCTRL_TRACE_DEPTH - 1)) == 0) ? 1 : -1];
+#endif
+
+/*Reset Causes Read From RESC Since Boot*/
+static SysCtrl_resetCauseType g_resetCause = 0;
+
+/*Main Oscillator Failure Record*/
+static SysCtrl_moscStatusType g_moscStatus;
+
+/*Main Oscillator Powered (MOSCDIS Clear) .. disabled out of reset*/
+static unsigned char g_moscPowered = 0;
+
+/*Low Power Modes*/
+static SysCtrl_powerStatsType g_powerStats;
+static volatile unsigned long g_wakeStamp;/*Taken By SysCtrl_markWake In The Wake Interrupt*/
+static volatile unsigned char g_wakeMarked = 0;
+static SysCtrl_systemClock g_deepSleepClock = PIOSC;
+static unsigned char g_autoClockGating = 0;
+
+/*Drivers Notified On System Clock Change*/
+static SysCtrl_clockChangeCallbackType g_clockChangeCallbacks[SYSCTRL_CLOCK_CHANGE_CALLBACKS];
+
+/*Number Of Users Holding Each Periphral Clock Gate*/
+static unsigned char g_gateRefCount[SYSCTRL_NUM_OF_PERIPHRALS][SYSCTRL_MAX_PERIPHRAL_INSTANCES];
+
+/*Instances With A Non Zero Reference Count .. one bit per instance*/
+static unsigned long g_gateHeld[SYSCTRL_NUM_OF_PERIPHRALS];
+
+/*Active Clock Profile (SYSCTRL_NUM_OF_PROFILES -> none)*/
+static SysCtrl_profileIdType g_activeProfile = SYSCTRL_NUM_OF_PROFILES;
+
+#if (SYSCTRL_GATE_OWNER_TRACKING == 1U)
+/*Owners Holding Each Periphral Clock Gate .. one bit per SysCtrl_gateOwnerType*/
+static unsigned long g_gateOwners[SYSCTRL_NUM_OF_PERIPHRALS][SYSCTRL_MAX_PERIPHRAL_INSTANCES];
+#endif
+
+#if (SYSCTRL_SHADOW_REGISTERS == 1U)
+/*Authoritative RAM Copies Of RCC, RCC2 And RCGCx (loaded from hardware on first use)*/
+static struct {
+	unsigned long rcc;
+	unsigned long rcc2;
+	unsigned long rcgc[SYSCTRL_SHADOW_RCGC_WORDS];
+	unsigned char valid;
+}g_shadow;
+
+/*Shadowed Writes Not Read Back As Written (SYSCTRL_SHADOW_CHECK)*/
+static unsigned long g_shadowMismatches = 0;
+#endif
+
+static const unsigned long g_RcgPreiphralOfsset[SYSCTRL_NUM_OF_PERIPHRALS] =
+{
+ SYSCTL_RCGCWD_R_OFFSET ,         
+ SYSCTL_RCGCTIMER_R_OFFSET ,      
+ SYSCTL_RCGCGPIO_R_OFFSET ,       
+ SYSCTL_RCGCDMA_R_OFFSET ,        
+ SYSCTL_RCGCHIB_R_OFFSET ,        
+ SYSCTL_RCGCUART_R_OFFSET ,       
+ SYSCTL_RCGCSSI_R_OFFSET ,        
+ SYSCTL_RCGCI2C_R_OFFSET ,        
+ SYSCTL_RCGCUSB_R_OFFSET ,        
+ SYSCTL_RCGCCAN_R_OFFSET ,        
+ SYSCTL_RCGCADC_R_OFFSET ,        
+ SYSCTL_RCGCACMP_R_OFFSET ,       
+ SYSCTL_RCGCPWM_R_OFFSET ,        
+ SYSCTL_RCGCQEI_R_OFFSET ,        
+ SYSCTL_RCGCEEPROM_R_OFFSET ,     
+ SYSCTL_RCGCWTIMER_R_OFFSET      
+};
+/**********************************************************************************************************************
+*  LOCAL FUNCTION
+*********************************************************************************************************************/
+static void SysCtrl_notifyClockChange(SysCtrl_clockChangeEventType event, SysCtrl_systemClock oldClock, SysCtrl_systemClock newClock);
+static SysCtrl_returnType SysCtrl_beginClockSwitch(const SysCtrl_configType *config_ptr);
+static void SysCtrl_completeClockSwitch(const SysCtrl_configType *config_ptr);
+static SysCtrl_returnType SysCtrl_applyClock(const SysCtrl_configType *config_ptr);
+static void SysCtrl_finishPendingClock(void);
+static SysCtrl_returnType SysCtrl_waitPllLock(void);
+static void SysCtrl_restartPll(void);
+static void SysCtrl_recordPllLock(void);
+static void SysCtrl_updateClockCache(void);
+static unsigned char SysCtrl_pioscDerived(const SysCtrl_configType *config_ptr);
+static SysCtrl_systemClock SysCtrl_nominalOscillatorClock(SysCtrl_ClockSourceType clocksource, SysCtrl_ExternalCrystalValueType xtal);
+static SysCtrl_systemClock SysCtrl_pioscScaled(SysCtrl_systemClock nominalClock);
+static SysCtrl_systemClock SysCtrl_measureClock(const SysCtrl_clockMeasureType *measure_ptr);
+static void SysCtrl_publishMeasuredClock(SysCtrl_systemClock measuredClock);
+static void SysCtrl_enableAutoClockGating(void);
+static unsigned long SysCtrl_wakeStart(void);
+static void SysCtrl_recordWake(unsigned long wakeStart);
+#if (SYSCTRL_GATE_ACCESS == SYSCTRL_GATE_ACCESS_BITBAND)
+static void SysCtrl_writeGateBits(unsigned long offset, unsigned long mask, unsigned long value);
+#endif
+#if (SYSCTRL_SHADOW_REGISTERS == 1U)
+static unsigned long *SysCtrl_shadowSlot(unsigned long offset);
+static void SysCtrl_shadowModify(unsigned long offset, unsigned long clearMask, unsigned long setMask, unsigned char commit);
+#endif
+
+
+/******************************************************************************
+* \Syntax          :SysCtrl_returnType SysCtrl_initPLL(SysCtrl_pllFreqType pllFreq, SysCtrl_systemClock requiredBusClock)       
+* \Description     : Function To Init Phase Locked Loop Module .. the system stays on the
+*                    raw oscillator when the PLL does not lock
+* \Sync\Async      : Synchronous                                               
+* \Reentrancy      : non Reentrant                                             
+* \Parameters (in) : pllFreq -> Determine To Use  Pll Divisor "PLL_200MHZ" OR not PLL_400MHZ
+									 : requiredBusClock -> desired bus clock To the System 
+* \Parameters (out): SYSCTRL_E_OK / SYSCTRL_E_TIMEOUT (PLL still bypassed)                                                                                   
+*******************************************************************************/
+SysCtrl_returnType SysCtrl_initPLL(SysCtrl_pllFreqType pllFreq, SysCtrl_systemClock requiredBusClock)
+{
+	SysCtrl_systemClock oscClock = (PLL_200MHZ == pllFreq) ? PLL_CLOCK_200 : PLL_CLOCK_400;
+	SysCtrl_systemDivType maxDiv = (PLL_200MHZ == pllFreq) ? 64 : 128;
+	SysCtrl_systemDivType minDiv = (oscClock + SYSCTRL_MAX_SYSTEM_HZ - 1) / SYSCTRL_MAX_SYSTEM_HZ;
+	SysCtrl_systemDivType div;
+	SysCtrl_returnType status;
+	unsigned long rcc;
+	unsigned long rcc2;
+
+	/*Divisor Kept Inside The SYSDIV2 Field And The 80 MHz Limit .. a bus clock of 0 or above the PLL output no longer wraps*/
+	div = (requiredBusClock == 0) ? maxDiv : (oscClock / requiredBusClock);
+	div = (div < minDiv) ? minDiv : ((div > maxDiv) ? maxDiv : div);
+	div = div - 1;
+
+	/*Lock Latency Is Measured In Core Cycles*/
+	SYSCTRL_CYCLE_COUNTER_ENABLE();
+
+	/*bypass PLL while initializing .. RCC2 only takes effect with USERCC2 set*/
+	SYSCTRL_REG_STAGE(SYSCTL_RCC2_R_OFFSET, 0, (SYSCTL_RCC2_USERCC2 | (1 << BYPASS2))); /*The system clock is derived from the OSC source*/
+
+	/*Activate PLL*/
+	SYSCTRL_REG_STAGE(SYSCTL_RCC2_R_OFFSET, (1 << PWRDN2), 0);
+
+	if (PLL_200MHZ == pllFreq)
+	{
+		/*Divide 200 MHz PLL Output By SYSDIV2 + 1*/
+		SYSCTRL_REG_STAGE(SYSCTL_RCC2_R_OFFSET, (SYSCTRL_RCC2_DIV400 | ~0xE03FFFFF), (div << SYSCTRL_RCC2_SYSDIV2_S));
+	}
+	else
+	{
+		/*Divide 400 MHz PLL Output By SYSDIV2:SYSDIV2LSB + 1*/
+		SYSCTRL_REG_STAGE(SYSCTL_RCC2_R_OFFSET, ~0xE03FFFFF, (SYSCTRL_RCC2_DIV400 | (div << SYSCTRL_RCC2_SYSDIV2LSB_S)));
+	}
+	SYSCTRL_REG_COMMIT(SYSCTL_RCC2_R_OFFSET);
+
+	/*wait PLL to lock .. stay on the oscillator if it never does*/
+	g_pllLockStart = SYSCTRL_CYCLE_COUNT();
+	g_pllAttemptStart = g_pllLockStart;
+	g_pllAttempt = 0;
+	status = SysCtrl_waitPllLock();
+	if (status == SYSCTRL_E_OK)
+	{
+		/* select PLL as the source of system clock*/
+		SYSCTRL_REG_MODIFY(SYSCTL_RCC2_R_OFFSET, (1 << BYPASS2), 0); /* remove bypass and use the PLL */
+		g_sysCtrlSystemClock = oscClock / (div + 1);
+	}
+	else
+	{
+		/*Bypassed .. the core runs from whatever oscillator RCC2 already selects*/
+		rcc = SYSCTL_REG_READ(SYSCTL_RCC_R_OFFSET);
+		rcc2 = SYSCTL_REG_READ(SYSCTL_RCC2_R_OFFSET);
+		g_sysCtrlSystemClock = SysCtrl_getOscillatorClock((SysCtrl_ClockSourceType)((rcc2 >> 4) & 0x7UL),
+		                                                  (SysCtrl_ExternalCrystalValueType)(((rcc >> 6) & 0x1FUL) - 6UL));
+	}
+	g_activeProfile = SYSCTRL_NUM_OF_PROFILES;
+	SysCtrl_updateClockCache();
+	return status;
+}
+
+/******************************************************************************
+* \Syntax          :SysCtrl_returnType SysCtrl_initSystemClock(const SysCtrl_configType *config_ptr)     
+* \Description     : Function To Init System Bus Clock .. if the PLL does not lock within
+*                    SYSCTRL_PLL_LOCK_TIMEOUT_CYCLES (after SYSCTRL_PLL_LOCK_RETRIES retries)
+*                    the system runs from sysCtrl_FallbackConfig instead
+* \Sync\Async      : Synchronous                                               
+* \Reentrancy      : non Reentrant                                             
+* \Parameters (in) : config_ptr -> configure System Bus Clock
+* \Parameters (out): SYSCTRL_E_OK / SYSCTRL_E_NOT_OK (NULL or unresolved configuration, nothing written) /
+*                    SYSCTRL_E_TIMEOUT (running on fallback clock)
+*******************************************************************************/
+
+SysCtrl_returnType SysCtrl_initSystemClock(const SysCtrl_configType *config_ptr)
+{
+	SysCtrl_returnType status = SYSCTRL_E_NOT_OK;
+
+	/* check if the input configuration pointer is not a NULL_PTR .. and was resolved by SYSCTRL_CLOCK_CONFIG */
+	if ((config_ptr != (void *)0) && (config_ptr->rcc2Image != 0))
+	{
+		status = SysCtrl_applyClock(config_ptr);
+		g_activeProfile = SYSCTRL_NUM_OF_PROFILES;
+		g_moscStatus.failedOver = 0;
+
+		/*Main Oscillator Clock Validation*/
+#if (SYSCTRL_MOSC_MONITOR == SYSCTRL_MOSC_MONITOR_FAILOVER)
+		SYSCTL_REG_WRITE(SYSCTL_MISC_R_OFFSET, (1 << MOFRIS));
+		SYSCTL_REG_WRITE(SYSCTL_MOSCCTL_R_OFFSET, ((1 << CVAL) | (1 << MOSCIM)));
+		SYSCTL_REG_MODIFY(SYSCTL_IMC_R_OFFSET, 0, (1 << MOFRIS));
+#elif (SYSCTRL_MOSC_MONITOR == SYSCTRL_MOSC_MONITOR_RESET)
+		SYSCTL_REG_WRITE(SYSCTL_MOSCCTL_R_OFFSET, (1 << CVAL));
+#endif
+
+		/*Deep-Sleep Clock Is Part Of The Configuration Set*/
+		(void)SysCtrl_setDeepSleepClock(&sysCtrl_DeepSleepConfig);
+	}
+	return status;
+}
+
+/******************************************************************************
+* \Syntax          : SysCtrl_returnType SysCtrl_startSystemClock(const SysCtrl_configType *config_ptr,
+*                                       SysCtrl_clockReadyCallbackType readyCallback)
+* \Description     : Start A System Clock Change And Return Without Waiting For PLL Lock.
+*                    The core keeps running from the raw oscillator until the switch is finished by
+*                    SysCtrl_pollSystemClock or SysCtrl_pllLockHandler (PLL lock interrupt),
+*                    which removes BYPASS2 and calls readyCallback.
+* \Sync\Async      : Asynchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : config_ptr -> new System Bus Clock configuration
+*                  : readyCallback -> called once the new clock is in use (may be NULL)
+* \Parameters (out): SYSCTRL_E_OK / SYSCTRL_E_NOT_OK (invalid or a switch is already pending) /
+*                    SYSCTRL_E_TIMEOUT (main oscillator never powered up, running on sysCtrl_FallbackConfig)
+*******************************************************************************/
+SysCtrl_returnType SysCtrl_startSystemClock(const SysCtrl_configType *config_ptr, SysCtrl_clockReadyCallbackType readyCallback)
+{
+	if ((config_ptr == (void *)0) || (config_ptr->rcc2Image == 0) || (g_pendingClockConfig != (void *)0) ||
+	    (g_moscStatus.failedOver && (CLOCK_SOURCE_MAIN_OSCILLATOR == config_ptr->clocksource)))
+	{
+		return SYSCTRL_E_NOT_OK;
+	}
+
+	SysCtrl_notifyClockChange(SYSCTRL_CLOCK_CHANGE_PRE, g_sysCtrlSystemClock, config_ptr->achievedClock);
+
+	g_sysCtrlConfigurations = config_ptr;
+	g_activeProfile = SYSCTRL_NUM_OF_PROFILES;
+	g_pendingClockConfig = config_ptr;
+	g_pendingClockOldClock = g_sysCtrlSystemClock;
+	g_clockReadyCallback = readyCallback;
+
+	/*Drop A Stale Lock Indication Before The PLL Is Reprogrammed*/
+	SYSCTL_REG_WRITE(SYSCTL_MISC_R_OFFSET, (1 << PLLLRIS));
+
+	if (SysCtrl_beginClockSwitch(config_ptr) != SYSCTRL_E_OK)
+	{
+		/*Main Oscillator Never Powered Up .. finish on a slower known clock*/
+		g_sysCtrlConfigurations = &sysCtrl_FallbackConfig;
+		g_pendingClockConfig = g_sysCtrlConfigurations;
+		(void)SysCtrl_beginClockSwitch(g_sysCtrlConfigurations);
+		SysCtrl_finishPendingClock();
+		return SYSCTRL_E_TIMEOUT;
+	}
+
+	if ((PLL_OPERATING_NORMALLY != config_ptr->plluse) || (SysCtrl_getPllStatus() == PLL_IS_LOCKED))
+	{
+		SysCtrl_finishPendingClock();
+	}
+	else
+	{
+		/*Unmask PLL Lock Interrupt .. a lock that lands before this store is still latched in RIS*/
+		SYSCTL_REG_MODIFY(SYSCTL_IMC_R_OFFSET, 0, (1 << PLLLRIS));
+	}
+	return SYSCTRL_E_OK;
+}
+
+/******************************************************************************
+* \Syntax          : SysCtrl_returnType SysCtrl_pollSystemClock(void)
+* \Description     : Finish A Pending System Clock Change If The PLL Has Locked
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): SYSCTRL_E_OK (no switch pending / finished now) / SYSCTRL_E_PENDING /
+*                    SYSCTRL_E_TIMEOUT (PLL failed, running on sysCtrl_FallbackConfig)
+*******************************************************************************/
+SysCtrl_returnType SysCtrl_pollSystemClock(void)
+{
+	if (g_pendingClockConfig == (void *)0)
+	{
+		return SYSCTRL_E_OK;
+	}
+
+	/*Mask PLL Lock Interrupt So SysCtrl_pllLockHandler Can Not Finish The Switch Under The Poll Path*/
+	SYSCTL_REG_MODIFY(SYSCTL_IMC_R_OFFSET, (1 << PLLLRIS), 0);
+	if (g_pendingClockConfig == (void *)0)
+	{
+		return SYSCTRL_E_OK; /*Finished By The Interrupt Before It Was Masked*/
+	}
+
+	if (SysCtrl_getPllStatus() == PLL_IS_UNLOCKED)
+	{
+		if ((SYSCTRL_CYCLE_COUNT() - g_pllAttemptStart) >= SYSCTRL_PLL_LOCK_TIMEOUT_CYCLES)
+		{
+			if (g_pllAttempt >= SYSCTRL_PLL_LOCK_RETRIES)
+			{
+				/*Degrade To A Slower Known Clock*/
+				g_pllStats.failureCount++;
+				SYSCTRL_TRACE_EVENT(SYSCTRL_TRACE_CLOCK_FALLBACK, 0, sysCtrl_FallbackConfig.achievedClock);
+				g_sysCtrlConfigurations = &sysCtrl_FallbackConfig;
+				g_pendingClockConfig = g_sysCtrlConfigurations;
+				(void)SysCtrl_beginClockSwitch(g_sysCtrlConfigurations);
+				SysCtrl_finishPendingClock();
+				return SYSCTRL_E_TIMEOUT;
+			}
+			SysCtrl_restartPll();
+		}
+
+		/*Still Pending .. a lock latched in RIS meanwhile interrupts once unmasked*/
+		SYSCTL_REG_MODIFY(SYSCTL_IMC_R_OFFSET, 0, (1 << PLLLRIS));
+		return SYSCTRL_E_PENDING;
+	}
+	SysCtrl_finishPendingClock();
+	return SYSCTRL_E_OK;
+}
+
+/******************************************************************************
+* \Syntax          : void SysCtrl_pllLockHandler(void)
+* \Description     : System Control Interrupt Handler Part For PLL Lock .. call from the SYSCTL ISR
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+*******************************************************************************/
+void SysCtrl_pllLockHandler(void)
+{
+	if (SYSCTL_REG_READ(SYSCTL_MISC_R_OFFSET) & (1 << PLLLRIS))
+	{
+		/*Acknowledge And Mask PLL Lock Interrupt*/
+		SYSCTL_REG_WRITE(SYSCTL_MISC_R_OFFSET, (1 << PLLLRIS));
+		SYSCTL_REG_MODIFY(SYSCTL_IMC_R_OFFSET, (1 << PLLLRIS), 0);
+
+		if (g_pendingClockConfig != (void *)0)
+		{
+			SysCtrl_finishPendingClock();
+		}
+	}
+}
+
+/******************************************************************************
+* \Syntax          : SysCtrl_returnType SysCtrl_planSystemClock(const SysCtrl_planRequestType *request_ptr,
+*                                       SysCtrl_configType *config_ptr)
+* \Description     : Search Every Legal Source / PLL / DIV400 / 7 Bit Divisor Combination For The
+*                    Requested Goal And Resolve The Result Into A Ready To Use Configuration.
+*                    On equal clocks the candidate without the PLL wins (lower power).
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : request_ptr -> planner goal, target clock, tolerance, crystal and allowed sources
+* \Parameters (out): config_ptr -> resolved configuration, achievedClock holds the exact clock in Hz
+*                    SYSCTRL_E_OK / SYSCTRL_E_NOT_OK (nothing reachable)
+*******************************************************************************/
+SysCtrl_returnType SysCtrl_planSystemClock(const SysCtrl_planRequestType *request_ptr, SysCtrl_configType *config_ptr)
+{
+	static const SysCtrl_ClockSourceType sources[] =
+	{
+		CLOCK_SOURCE_MAIN_OSCILLATOR,
+		CLOCK_SOURCE_PRECISION_INTERNAL_OSCILLATOR,
+		CLOCK_SOURCE_PRECISION_INTERNAL_OSCILLATOR_DIVDED_4,
+		CLOCK_SOURCE_LOW_FREQUENCY_INTERNAL_OSCILLATOR,
+		CLOCK_SOURCE_HIBERNTION_OSCILLATOR
+	};
+	SysCtrl_systemClock target;
+	SysCtrl_systemClock input;
+	SysCtrl_systemClock achieved;
+	SysCtrl_systemClock error;
+	SysCtrl_systemClock bestError = 0;
+	SysCtrl_systemClock bestClock = 0;
+	SysCtrl_systemDivType div;
+	SysCtrl_systemDivType minDiv;
+	SysCtrl_systemDivType maxDiv;
+	SysCtrl_systemDivType bestDiv = 0;
+	SysCtrl_pllUsageType plluse;
+	SysCtrl_pllFreqType pll;
+	unsigned char sourceIndex;
+	unsigned char mode;
+	signed char step;
+
+	if ((request_ptr == (void *)0) || (config_ptr == (void *)0) || (request_ptr->targetClock == 0) ||
+	    (request_ptr->xtal > XTAL_25MHZ))
+	{
+		return SYSCTRL_E_NOT_OK;
+	}
+
+	target = request_ptr->targetClock;
+	if ((request_ptr->goal == SYSCTRL_PLAN_MAX_UNDER_CAP) && (target > SYSCTRL_MAX_SYSTEM_HZ))
+	{
+		target = SYSCTRL_MAX_SYSTEM_HZ;
+	}
+
+	for (sourceIndex = 0; sourceIndex < (sizeof(sources) / sizeof(sources[0])); sourceIndex++)
+	{
+		if ((request_ptr->allowedSources & SYSCTRL_PLAN_SOURCE(sources[sourceIndex])) == 0)
+		{
+			continue;
+		}
+
+		/*mode 0 -> PLL powered down, 1 -> PLL 200 MHz / SYSDIV2, 2 -> PLL 400 MHz / SYSDIV2:SYSDIV2LSB*/
+		for (mode = 0; mode < 3; mode++)
+		{
+			plluse = (mode == 0) ? PLL_POWERED_DOWM : PLL_OPERATING_NORMALLY;
+			pll = (mode == 2) ? PLL_400MHZ : PLL_200MHZ;
+
+			if (SYSCTRL_USES_PLL(plluse) && (sources[sourceIndex] != CLOCK_SOURCE_PRECISION_INTERNAL_OSCILLATOR) &&
+			    ((sources[sourceIndex] != CLOCK_SOURCE_MAIN_OSCILLATOR) ||
+			     (SysCtrl_getCrystalClock(request_ptr->xtal) < SYSCTRL_PLL_MIN_INPUT_HZ)))
+			{
+				continue; /*PLL Reference Must Be PIOSC Or A Crystal Of At Least 5 MHz*/
+			}
+
+			input = SYSCTRL_USES_PLL(plluse) ? ((pll == PLL_400MHZ) ? PLL_CLOCK_400 : PLL_CLOCK_200)
+			                                 : SysCtrl_nominalOscillatorClock(sources[sourceIndex], request_ptr->xtal);
+			maxDiv = SYSCTRL_MAX_DIVISOR(plluse, pll);
+			minDiv = (input + SYSCTRL_MAX_SYSTEM_HZ - 1) / SYSCTRL_MAX_SYSTEM_HZ;
+
+			if (request_ptr->goal == SYSCTRL_PLAN_MAX_UNDER_CAP)
+			{
+				div = (input + target - 1) / target;
+				div = (div < minDiv) ? minDiv : div;
+				if (div > maxDiv)
+				{
+					continue;
+				}
+				achieved = input / div;
+				if (achieved > bestClock)
+				{
+					bestClock = achieved;
+					bestDiv = div;
+					config_ptr->clocksource = sources[sourceIndex];
+					config_ptr->plluse = plluse;
+					config_ptr->pll = pll;
+				}
+				continue;
+			}
+
+			/*Closest .. nearest divisor and its neighbours*/
+			for (step = -1; step <= 1; step++)
+			{
+				div = ((input + (target / 2)) / target) + step;
+				if ((div < minDiv) || (div > maxDiv) || (div == 0))
+				{
+					continue;
+				}
+				achieved = input / div;
+				error = SYSCTRL_ABS_DIFF(achieved, target);
+				if ((error <= ((target / 1000UL) * request_ptr->tolerancePermille)) &&
+				    ((bestClock == 0) || (error < bestError)))
+				{
+					bestError = error;
+					bestClock = achieved;
+					bestDiv = div;
+					config_ptr->clocksource = sources[sourceIndex];
+					config_ptr->plluse = plluse;
+					config_ptr->pll = pll;
+				}
+			}
+		}
+	}
+
+	if (bestClock == 0)
+	{
+		return SYSCTRL_E_NOT_OK;
+	}
+
+	config_ptr->xtal = request_ptr->xtal;
+	config_ptr->desiredClock = request_ptr->targetClock;
+	config_ptr->rccImage = SYSCTRL_RCC_IMAGE(config_ptr->clocksource, config_ptr->xtal);
+	config_ptr->rcc2Image = SYSCTRL_RCC2_IMAGE_DIV(config_ptr->clocksource, config_ptr->plluse, config_ptr->pll, bestDiv);
+	config_ptr->achievedClock = bestClock;
+	return SYSCTRL_E_OK;
+}
+
+/******************************************************************************
+* \Syntax          : SysCtrl_systemClock SysCtrl_getSystemClock(void)
+* \Description     : Current System Clock (cached, O(1))
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): system clock in Hz
+*******************************************************************************/
+SysCtrl_systemClock SysCtrl_getSystemClock(void)
+{
+	return g_sysCtrlSystemClock;
+}
+
+/******************************************************************************
+* \Syntax          : SysCtrl_systemClock SysCtrl_getUsbClock(void)
+* \Description     : USB Clock Of The Active Configuration (cached, O(1)) .. only configurations built
+*                    with SYSCTRL_CLOCK_CONFIG_USB power the USB PLL
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): USB clock in Hz (0 -> USB PLL powered down)
+*******************************************************************************/
+SysCtrl_systemClock SysCtrl_getUsbClock(void)
+{
+	return g_usbClock;
+}
+
+/******************************************************************************
+* \Syntax          : SysCtrl_systemClock SysCtrl_getPeripheralClock(SysCtrl_systemPeriphralType periphral,
+*                                       SysCtrl_periphralInstanceType instance)
+* \Description     : Clock Feeding A Periphral Instance (cached, O(1)) .. PWM divider, ADC clock and
+*                    the alternate clock choice of UART/SSI/timer instances are taken into account
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : periphral / perphiral instance
+* \Parameters (out): clock in Hz
+*******************************************************************************/
+SysCtrl_systemClock SysCtrl_getPeripheralClock(SysCtrl_systemPeriphralType periphral, SysCtrl_periphralInstanceType instance)
+{
+	SysCtrl_systemClock clock = g_sysCtrlSystemClock;
+
+	switch (periphral)
+	{
+	case SYSCTL_CPWM:
+		clock = g_pwmClock;
+		break;
+	case SYSCTL_CADC:
+		clock = g_adcClock;
+		break;
+	case SYSCTL_TIMER:
+	case SYSCTL_CUART:
+	case SYSCTL_CSSI:
+	case SYSCTL_CWTIMER:
+		if ((instance < 32) && (g_altClockInstances[periphral] & (1UL << instance)))
+		{
+			clock = g_altClock;
+		}
+		break;
+	default:
+		break;
+	}
+	return clock;
+}
+
+/******************************************************************************
+* \Syntax          : SysCtrl_returnType SysCtrl_setPeripheralClockSource(SysCtrl_systemPeriphralType periphral,
+*                                       SysCtrl_periphralInstanceType instance, SysCtrl_periphralClockSourceType source)
+* \Description     : Record The Clock Source A UART/SSI/Timer Driver Programmed In UARTCC/SSICC/GPTMCC ..
+*                    instances on the alternate clock keep their rate across system clock changes
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : periphral / perphiral instance / source -> system or alternate (ALTCLKCFG) clock
+* \Parameters (out): SYSCTRL_E_OK / SYSCTRL_E_NOT_OK
+*******************************************************************************/
+SysCtrl_returnType SysCtrl_setPeripheralClockSource(SysCtrl_systemPeriphralType periphral, SysCtrl_periphralInstanceType instance, SysCtrl_periphralClockSourceType source)
+{
+	if (((periphral != SYSCTL_CUART) && (periphral != SYSCTL_CSSI) && (periphral != SYSCTL_TIMER) && (periphral != SYSCTL_CWTIMER)) ||
+	    (instance >= 32))
+	{
+		return SYSCTRL_E_NOT_OK;
+	}
+
+	if (SYSCTRL_PERIPHRAL_CLOCK_ALTERNATE == source)
+	{
+		g_altClockInstances[periphral] |= (1UL << instance);
+	}
+	else
+	{
+		g_altClockInstances[periphral] &= ~(1UL << instance);
+	}
+	return SYSCTRL_E_OK;
+}
+
+/******************************************************************************
+* \Syntax          : SysCtrl_returnType SysCtrl_setAltClockSource(SysCtrl_altClockSourceType source)
+* \Description     : Select The Alternate Clock (ALTCLKCFG) Of The UART/SSI/Timer Instances Recorded With
+*                    SysCtrl_setPeripheralClockSource .. their drivers have to requery SysCtrl_getPeripheralClock
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : source -> PIOSC, RTCOSC or LFIOSC
+* \Parameters (out): SYSCTRL_E_OK / SYSCTRL_E_NOT_OK
+*******************************************************************************/
+SysCtrl_returnType SysCtrl_setAltClockSource(SysCtrl_altClockSourceType source)
+{
+	if ((source != SYSCTRL_ALT_CLOCK_PIOSC) && (source != SYSCTRL_ALT_CLOCK_RTCOSC) && (source != SYSCTRL_ALT_CLOCK_LFIOSC))
+	{
+		return SYSCTRL_E_NOT_OK;
+	}
+
+	SYSCTL_REG_MODIFY(SYSCTL_ALTCLKCFG_R_OFFSET, SYSCTL_ALTCLKCFG_ALTCLK_M, ((unsigned long)source & SYSCTL_ALTCLKCFG_ALTCLK_M)); /*Reserved Bits Kept*/
+	g_altClockSource = source;
+	SysCtrl_updateClockCache();
+	return SYSCTRL_E_OK;
+}
+
+/******************************************************************************
+* \Syntax          : SysCtrl_systemClock SysCtrl_getAltClock(void)
+* \Description     : Alternate Clock (cached, O(1)) .. follows PIOSC calibration
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): alternate clock in Hz
+*******************************************************************************/
+SysCtrl_systemClock SysCtrl_getAltClock(void)
+{
+	return g_altClock;
+}
+
+/******************************************************************************
+* \Syntax          : void SysCtrl_getAltClockInstances(SysCtrl_periphralSetType *set_ptr)
+* \Description     : Instances Running From The Alternate Clock .. a clock change callback can skip them
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): set_ptr -> instances on the alternate clock
+*******************************************************************************/
+void SysCtrl_getAltClockInstances(SysCtrl_periphralSetType *set_ptr)
+{
+	unsigned char periphral;
+
+	if (set_ptr != (void *)0)
+	{
+		for (periphral = 0; periphral < SYSCTRL_NUM_OF_PERIPHRALS; periphral++)
+		{
+			set_ptr->instanceMask[periphral] = g_altClockInstances[periphral];
+		}
+	}
+}
+
+/******************************************************************************
+* \Syntax          : SysCtrl_returnType SysCtrl_setPwmClockDivider(unsigned char divider)
+* \Description     : Set The PWM Unit Clock Divider In RCC (USEPWMDIV/PWMDIV)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : divider -> 1 (undivided), 2, 4, 8, 16, 32 or 64
+* \Parameters (out): SYSCTRL_E_OK / SYSCTRL_E_NOT_OK
+*******************************************************************************/
+SysCtrl_returnType SysCtrl_setPwmClockDivider(unsigned char divider)
+{
+	unsigned long pwmDiv = 0;
+	unsigned char shift = 0;
+
+	if (divider == 1)
+	{
+		SYSCTRL_REG_MODIFY(SYSCTL_RCC_R_OFFSET, (1UL << USEPWMDIV), 0);
+	}
+	else
+	{
+		/*PWMDIV 0 -> /2 .. 5 -> /64*/
+		while ((2U << pwmDiv) < divider)
+		{
+			pwmDiv++;
+		}
+		if ((pwmDiv > 5) || ((2U << pwmDiv) != divider))
+		{
+			return SYSCTRL_E_NOT_OK;
+		}
+		SYSCTRL_REG_MODIFY(SYSCTL_RCC_R_OFFSET, SYSCTL_RCC_PWMDIV_M, ((1UL << USEPWMDIV) | (pwmDiv << PWMDIV_S)));
+		shift = (unsigned char)(pwmDiv + 1);
+	}
+
+	g_pwmDivShift = shift;
+	SysCtrl_updateClockCache();
+	return SYSCTRL_E_OK;
+}
+
+/******************************************************************************
+* \Syntax          : SysCtrl_returnType SysCtrl_measureSystemClock(const SysCtrl_clockMeasureType *measure_ptr,
+*                                       SysCtrl_systemClock *clock_ptr)
+* \Description     : Measure The Real System Clock Against A Reference And Publish It Through
+*                    SysCtrl_getSystemClock / SysCtrl_getPeripheralClock .. when the system clock comes
+*                    from PIOSC the measured PIOSC frequency is published as well
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : measure_ptr -> measurement callback, reference clock and periods
+* \Parameters (out): clock_ptr -> measured system clock in Hz (may be NULL)
+*                    SYSCTRL_E_OK / SYSCTRL_E_NOT_OK
+*******************************************************************************/
+SysCtrl_returnType SysCtrl_measureSystemClock(const SysCtrl_clockMeasureType *measure_ptr, SysCtrl_systemClock *clock_ptr)
+{
+	SysCtrl_systemClock measuredClock;
+
+	if ((measure_ptr == (void *)0) || (measure_ptr->measure == (void *)0) || (measure_ptr->periods == 0))
+	{
+		return SYSCTRL_E_NOT_OK;
+	}
+
+	measuredClock = SysCtrl_measureClock(measure_ptr);
+	if (measuredClock == 0)
+	{
+		return SYSCTRL_E_NOT_OK;
+	}
+
+	SysCtrl_publishMeasuredClock(measuredClock);
+	if (clock_ptr != (void *)0)
+	{
+		*clock_ptr = measuredClock;
+	}
+	return SYSCTRL_E_OK;
+}
+
+/******************************************************************************
+* \Syntax          : SysCtrl_returnType SysCtrl_calibratePiosc(const SysCtrl_clockMeasureType *measure_ptr)
+* \Description     : Trim PIOSC (PIOSCCAL user trim) Until The Measured System Clock Is Closest To The
+*                    Configured One, Then Publish The Measured Clocks .. binary search over the 7 bit trim,
+*                    one measurement per step. The system clock has to come from PIOSC.
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : measure_ptr -> measurement callback, reference clock and periods
+* \Parameters (out): SYSCTRL_E_OK / SYSCTRL_E_NOT_OK (not running from PIOSC, or measurement failed ..
+*                    the factory trim is restored)
+*******************************************************************************/
+SysCtrl_returnType SysCtrl_calibratePiosc(const SysCtrl_clockMeasureType *measure_ptr)
+{
+	/*Trim Towards The Nominal Clock .. achievedClock never carries the measured drift*/
+	SysCtrl_systemClock nominalClock = (g_sysCtrlConfigurations != (void *)0) ? g_sysCtrlConfigurations->achievedClock : PIOSC;
+	SysCtrl_systemClock measuredClock;
+	SysCtrl_systemClock bestClock = 0;
+	unsigned long error;
+	unsigned long bestError = ~0UL;
+	unsigned long low = 0;
+	unsigned long high = SYSCTL_PIOSCCAL_UT_M + 1;
+	unsigned long trim;
+	unsigned long bestTrim = 0;
+
+	if ((measure_ptr == (void *)0) || (measure_ptr->measure == (void *)0) || (measure_ptr->periods == 0) || !SysCtrl_pioscDerived(g_sysCtrlConfigurations))
+	{
+		return SYSCTRL_E_NOT_OK;
+	}
+
+	/*A Higher Trim Runs PIOSC Faster*/
+	while (low < high)
+	{
+		trim = (low + high) / 2;
+		SYSCTL_REG_WRITE(SYSCTL_PIOSCCAL_R_OFFSET, ((1UL << UTEN) | (1UL << UPDATE) | trim));
+
+		measuredClock = SysCtrl_measureClock(measure_ptr);
+		if (measuredClock == 0)
+		{
+			/*Back To The Factory Trim*/
+			SYSCTL_REG_WRITE(SYSCTL_PIOSCCAL_R_OFFSET, (1UL << UPDATE));
+			return SYSCTRL_E_NOT_OK;
+		}
+
+		error = (measuredClock > nominalClock) ? (measuredClock - nominalClock) : (nominalClock - measuredClock);
+		if (error < bestError)
+		{
+			bestError = error;
+			bestTrim = trim;
+			bestClock = measuredClock;
+		}
+
+		if (measuredClock < nominalClock)
+		{
+			low = trim + 1;
+		}
+		else
+		{
+			high = trim;
+		}
+	}
+
+	SYSCTL_REG_WRITE(SYSCTL_PIOSCCAL_R_OFFSET, ((1UL << UTEN) | (1UL << UPDATE) | bestTrim));
+	SysCtrl_publishMeasuredClock(bestClock);
+	SYSCTRL_TRACE_EVENT(SYSCTRL_TRACE_PIOSC_TRIM, bestTrim, g_pioscClock);
+	return SYSCTRL_E_OK;
+}
+
+/******************************************************************************
+* \Syntax          : SysCtrl_systemClock SysCtrl_getCrystalClock(SysCtrl_ExternalCrystalValueType attachedCrystal)
+* \Description     : Attached Crystal Frequency (table lookup)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : attachedCrystal -> attached Crystal
+* \Parameters (out): crystal clock in Hz (0 -> unknown crystal)
+*******************************************************************************/
+SysCtrl_systemClock SysCtrl_getCrystalClock(SysCtrl_ExternalCrystalValueType attachedCrystal)
+{
+	return (attachedCrystal <= XTAL_25MHZ) ? g_crystalClock[attachedCrystal] : 0;
+}
+
+/******************************************************************************
+* \Syntax          : SysCtrl_systemClock SysCtrl_getOscillatorClock(SysCtrl_ClockSourceType clocksource,
+*                                       SysCtrl_ExternalCrystalValueType xtal)
+* \Description     : Oscillator Clock For A Clock Source .. PIOSC as last measured
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : clocksource -> oscillator Clock Source / xtal -> Attached Crystal
+* \Parameters (out): oscillator clock in Hz
+*******************************************************************************/
+SysCtrl_systemClock SysCtrl_getOscillatorClock(SysCtrl_ClockSourceType clocksource, SysCtrl_ExternalCrystalValueType xtal)
+{
+	SysCtrl_systemClock oscClock = SysCtrl_nominalOscillatorClock(clocksource, xtal);
+
+	if ((CLOCK_SOURCE_PRECISION_INTERNAL_OSCILLATOR == clocksource) ||
+	    (CLOCK_SOURCE_PRECISION_INTERNAL_OSCILLATOR_DIVDED_4 == clocksource))
+	{
+		oscClock = SysCtrl_pioscScaled(oscClock);
+	}
+	return oscClock;
+}
+
+/******************************************************************************
+* \Syntax          : void SysCtrl_getPllStats(SysCtrl_pllStatsType *stats_ptr)
+* \Description     : Get PLL Lock Latency, Retry And Failure Statistics
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): stats_ptr -> PLL statistics
+*******************************************************************************/
+void SysCtrl_getPllStats(SysCtrl_pllStatsType *stats_ptr)
+{
+	if (stats_ptr != (void *)0)
+	{
+		*stats_ptr = g_pllStats;
+	}
+}
+
+/******************************************************************************
+* \Syntax          : SysCtrl_returnType SysCtrl_setSystemClock(const SysCtrl_configType *config_ptr)
+* \Description     : Change System Clock At Runtime .. the core runs from the raw oscillator
+*                    while the PLL relocks, registered callbacks are notified before and after
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : config_ptr -> new System Bus Clock configuration
+* \Parameters (out): SYSCTRL_E_OK / SYSCTRL_E_NOT_OK / SYSCTRL_E_TIMEOUT (running on fallback clock)
+*******************************************************************************/
+SysCtrl_returnType SysCtrl_setSystemClock(const SysCtrl_configType *config_ptr)
+{
+	SysCtrl_systemClock oldClock = g_sysCtrlSystemClock;
+	SysCtrl_returnType status;
+
+	if ((config_ptr == (void *)0) || (config_ptr->rcc2Image == 0) || (g_pendingClockConfig != (void *)0) ||
+	    (g_moscStatus.failedOver && (CLOCK_SOURCE_MAIN_OSCILLATOR == config_ptr->clocksource)))
+	{
+		return SYSCTRL_E_NOT_OK;
+	}
+
+	SysCtrl_notifyClockChange(SYSCTRL_CLOCK_CHANGE_PRE, oldClock, config_ptr->achievedClock);
+
+	status = SysCtrl_applyClock(config_ptr);
+	g_activeProfile = SYSCTRL_NUM_OF_PROFILES;
+
+	SysCtrl_notifyClockChange(SYSCTRL_CLOCK_CHANGE_POST, oldClock, g_sysCtrlSystemClock);
+
+	return status;
+}
+
+/******************************************************************************
+* \Syntax          : SysCtrl_returnType SysCtrl_switchProfile(SysCtrl_profileIdType profileId)
+* \Description     : Switch To One Of The Configured Clock Profiles .. direct index, no divisor math.
+*                    Register accesses:
+*                      clock  -> none when the profile clock is already selected,
+*                                2 RMW + 1 write without PLL,
+*                                2 RMW + 2 writes + PLLSTAT polls (bounded by SYSCTRL_PLL_LOCK_TIMEOUT_CYCLES
+*                                for each of SYSCTRL_PLL_LOCK_RETRIES + 1 attempts) with PLL,
+*                                + 1 MISC write + RIS (MOSCPUPRIS) polls bounded by
+*                                SYSCTRL_MOSC_POWER_UP_TIMEOUT_CYCLES when the main oscillator is powered up,
+*                                + 2 RMW + 1 write for sysCtrl_FallbackConfig when either wait times out
+*                      gates  -> 1 RMW per periphral with a non empty gatesOn / gatesOff mask
+*                                (one store per gate bit with SYSCTRL_GATE_ACCESS_BITBAND)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : profileId -> index in sysCtrl_Profiles (SYSCTRL_PROFILE_xxx)
+* \Parameters (out): SYSCTRL_E_OK / SYSCTRL_E_NOT_OK / SYSCTRL_E_TIMEOUT (running on fallback clock)
+*******************************************************************************/
+SysCtrl_returnType SysCtrl_switchProfile(SysCtrl_profileIdType profileId)
+{
+	const SysCtrl_profileType *profile_ptr;
+	SysCtrl_returnType status = SYSCTRL_E_OK;
+	unsigned char periphral;
+	unsigned long gatesOff;
+
+	if ((profileId >= SYSCTRL_NUM_OF_PROFILES) || (g_pendingClockConfig != (void *)0))
+	{
+		return SYSCTRL_E_NOT_OK;
+	}
+	profile_ptr = &sysCtrl_Profiles[profileId];
+
+	if (g_sysCtrlConfigurations != &profile_ptr->clock)
+	{
+		status = SysCtrl_setSystemClock(&profile_ptr->clock);
+	}
+
+	for (periphral = 0; periphral < SYSCTRL_NUM_OF_PERIPHRALS; periphral++)
+	{
+		gatesOff = profile_ptr->gatesOff.instanceMask[periphral] & ~g_gateHeld[periphral];
+		if ((gatesOff | profile_ptr->gatesOn.instanceMask[periphral]) != 0)
+		{
+			SYSCTRL_GATE_MASK_WRITE(SYSCTL_RCGC_OFFSET + g_RcgPreiphralOfsset[periphral], gatesOff,
+			                        profile_ptr->gatesOn.instanceMask[periphral]);
+#if (SYSCTRL_TRACE == 1U)
+			if (gatesOff != 0)
+			{
+				SYSCTRL_TRACE_EVENT(SYSCTRL_TRACE_GATE_DISABLE, periphral, gatesOff);
+			}
+			if (profile_ptr->gatesOn.instanceMask[periphral] != 0)
+			{
+				SYSCTRL_TRACE_EVENT(SYSCTRL_TRACE_GATE_ENABLE, periphral, profile_ptr->gatesOn.instanceMask[periphral]);
+			}
+#endif
+		}
+	}
+
+	g_activeProfile = (g_sysCtrlConfigurations == &profile_ptr->clock) ? profileId : SYSCTRL_NUM_OF_PROFILES;
+	return status;
+}
+
+/******************************************************************************
+* \Syntax          : SysCtrl_profileIdType SysCtrl_getProfile(void)
+* \Description     : Active Clock Profile
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): index in sysCtrl_Profiles, SYSCTRL_NUM_OF_PROFILES when the clock was set otherwise
+*******************************************************************************/
+SysCtrl_profileIdType SysCtrl_getProfile(void)
+{
+	return g_activeProfile;
+}
+
+/******************************************************************************
+* \Syntax          : SysCtrl_returnType SysCtrl_registerClockChangeCallback(SysCtrl_clockChangeCallbackType callback)
+* \Description     : Register A Driver Callback Called Before And After Every System Clock Change
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : callback -> function to notify
+* \Parameters (out): SYSCTRL_E_OK / SYSCTRL_E_NOT_OK (no free slot)
+*******************************************************************************/
+SysCtrl_returnType SysCtrl_registerClockChangeCallback(SysCtrl_clockChangeCallbackType callback)
+{
+	unsigned char index;
+
+	if (callback == (void *)0)
+	{
+		return SYSCTRL_E_NOT_OK;
+	}
+
+	for (index = 0; index < SYSCTRL_CLOCK_CHANGE_CALLBACKS; index++)
+	{
+		if (g_clockChangeCallbacks[index] == (void *)0)
+		{
+			g_clockChangeCallbacks[index] = callback;
+			return SYSCTRL_E_OK;
+		}
+	}
+	return SYSCTRL_E_NOT_OK;
+}
+
+/******************************************************************************
+* \Syntax          : void SysCtrl_unregisterClockChangeCallback(SysCtrl_clockChangeCallbackType callback)
+* \Description     : Remove A Registered Clock Change Callback
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : callback -> function to remove
+* \Parameters (out): None
+*******************************************************************************/
+void SysCtrl_unregisterClockChangeCallback(SysCtrl_clockChangeCallbackType callback)
+{
+	unsigned char index;
+
+	for (index = 0; index < SYSCTRL_CLOCK_CHANGE_CALLBACKS; index++)
+	{
+		if (g_clockChangeCallbacks[index] == callback)
+		{
+			g_clockChangeCallbacks[index] = (void *)0;
+		}
+	}
+}
+
+/******************************************************************************
+* \Syntax          : void SysCtrl_lowPowerGateEnable(SysCtrl_powerModeType mode,
+*                                       SysCtrl_systemPeriphralType periphral, SysCtrl_periphralInstanceType instance)
+* \Description     : Keep A Periphral Instance Clocked In Sleep (SCGCx) Or Deep-Sleep (DCGCx).
+*                    The first gate policy turns on auto clock gating (RCC ACG), after which every
+*                    instance not enabled here is stopped on WFI.
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : mode -> sleep or deep-sleep / periphral / perphiral instance
+* \Parameters (out): None
+*******************************************************************************/
+void SysCtrl_lowPowerGateEnable(SysCtrl_powerModeType mode, SysCtrl_systemPeriphralType periphral, SysCtrl_periphralInstanceType instance)
+{
+	unsigned long base = (SYSCTRL_POWER_MODE_SLEEP == mode) ? SYSCTL_SCGC_OFFSET : SYSCTL_DCGC_OFFSET;
+
+	SysCtrl_enableAutoClockGating();
+	SYSCTRL_GATE_BIT_SET(base + g_RcgPreiphralOfsset[periphral], instance);
+}
+
+/******************************************************************************
+* \Syntax          : void SysCtrl_lowPowerGateDisable(SysCtrl_powerModeType mode,
+*                                       SysCtrl_systemPeriphralType periphral, SysCtrl_periphralInstanceType instance)
+* \Description     : Stop A Periphral Instance Clock In Sleep (SCGCx) Or Deep-Sleep (DCGCx)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : mode -> sleep or deep-sleep / periphral / perphiral instance
+* \Parameters (out): None
+*******************************************************************************/
+void SysCtrl_lowPowerGateDisable(SysCtrl_powerModeType mode, SysCtrl_systemPeriphralType periphral, SysCtrl_periphralInstanceType instance)
+{
+	unsigned long base = (SYSCTRL_POWER_MODE_SLEEP == mode) ? SYSCTL_SCGC_OFFSET : SYSCTL_DCGC_OFFSET;
+
+	SysCtrl_enableAutoClockGating();
+	SYSCTRL_GATE_BIT_CLEAR(base + g_RcgPreiphralOfsset[periphral], instance);
+}
+
+/******************************************************************************
+* \Syntax          : void SysCtrl_setLowPowerGates(SysCtrl_powerModeType mode, const SysCtrl_periphralSetType *set_ptr)
+* \Description     : Replace The Whole Sleep Or Deep-Sleep Gate Policy .. exactly the instances in
+*                    the set stay clocked, one store per gating register
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : mode -> sleep or deep-sleep / set_ptr -> instances kept clocked
+* \Parameters (out): None
+*******************************************************************************/
+void SysCtrl_setLowPowerGates(SysCtrl_powerModeType mode, const SysCtrl_periphralSetType *set_ptr)
+{
+	unsigned long base = (SYSCTRL_POWER_MODE_SLEEP == mode) ? SYSCTL_SCGC_OFFSET : SYSCTL_DCGC_OFFSET;
+	unsigned char periphral;
+
+	if (set_ptr == (void *)0)
+	{
+		return;
+	}
+
+	SysCtrl_enableAutoClockGating();
+	for (periphral = 0; periphral < SYSCTRL_NUM_OF_PERIPHRALS; periphral++)
+	{
+		SYSCTRL_REG_WRITE(base + g_RcgPreiphralOfsset[periphral], set_ptr->instanceMask[periphral]);
+	}
+}
+
+/******************************************************************************
+* \Syntax          : SysCtrl_returnType SysCtrl_setDeepSleepClock(const SysCtrl_deepSleepConfigType *config_ptr)
+* \Description     : Select The Deep-Sleep Oscillator And Divisor (DSLPCLKCFG)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : config_ptr -> deep-sleep clock
+* \Parameters (out): SYSCTRL_E_OK / SYSCTRL_E_NOT_OK
+*******************************************************************************/
+SysCtrl_returnType SysCtrl_setDeepSleepClock(const SysCtrl_deepSleepConfigType *config_ptr)
+{
+	SysCtrl_ExternalCrystalValueType xtal;
+
+	if ((config_ptr == (void *)0) || (config_ptr->divisor == 0) || (config_ptr->divisor > 64) ||
+	    (config_ptr->clocksource == CLOCK_SOURCE_PRECISION_INTERNAL_OSCILLATOR_DIVDED_4))
+	{
+		return SYSCTRL_E_NOT_OK;
+	}
+
+	SYSCTL_REG_MODIFY(SYSCTL_DSLPCLKCFG_R_OFFSET, SYSCTL_DSLPCLKCFG_M,
+	                  ((((unsigned long)config_ptr->divisor - 1) << DSDIVORIDE_S) |
+	                   ((unsigned long)config_ptr->clocksource << DSOSCSRC_S)));
+
+	xtal = (g_sysCtrlConfigurations != (void *)0) ? g_sysCtrlConfigurations->xtal : sysCtrl_Config.xtal;
+	g_deepSleepClock = SysCtrl_getOscillatorClock(config_ptr->clocksource, xtal) / config_ptr->divisor;
+	return SYSCTRL_E_OK;
+}
+
+/******************************************************************************
+* \Syntax          : SysCtrl_systemClock SysCtrl_getDeepSleepClock(void)
+* \Description     : System Clock While In Deep-Sleep (clock of DCGCx enabled periphrals)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): deep-sleep clock in Hz
+*******************************************************************************/
+SysCtrl_systemClock SysCtrl_getDeepSleepClock(void)
+{
+	return g_deepSleepClock;
+}
+
+/******************************************************************************
+* \Syntax          : void SysCtrl_enterSleep(void)
+* \Description     : Stop The Core Clock Until The Next Interrupt .. the run clock is kept, so
+*                    the core resumes at full speed. The wake latency is recorded like deep-sleep.
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+*******************************************************************************/
+void SysCtrl_enterSleep(void)
+{
+	g_powerStats.sleepCount++;
+	SYSCTRL_TRACE_EVENT(SYSCTRL_TRACE_SLEEP, SYSCTRL_POWER_MODE_SLEEP, 0);
+	g_wakeMarked = 0;
+	SYSCTRL_WAIT_FOR_INTERRUPT(0);
+	SysCtrl_recordWake(SysCtrl_wakeStart());
+	SYSCTRL_TRACE_EVENT(SYSCTRL_TRACE_WAKE, SYSCTRL_POWER_MODE_SLEEP, g_powerStats.lastWakeCycles);
+}
+
+/******************************************************************************
+* \Syntax          : SysCtrl_returnType SysCtrl_enterDeepSleep(void)
+* \Description     : Enter Deep-Sleep Until The Next Interrupt And Restore The Run Clock On Wake.
+*                    A PLL run clock is bypassed before WFI so the core resumes on the raw
+*                    oscillator at once, and is reselected here after the PLL relocks.
+*                    Wake interrupt handlers therefore run on the oscillator clock. The wake latency
+*                    includes the handler only when it calls SysCtrl_markWake.
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): SYSCTRL_E_OK / SYSCTRL_E_PENDING (clock switch pending, not entered) /
+*                    SYSCTRL_E_TIMEOUT (PLL failed on wake, running on sysCtrl_FallbackConfig)
+*******************************************************************************/
+SysCtrl_returnType SysCtrl_enterDeepSleep(void)
+{
+	SysCtrl_returnType status = SYSCTRL_E_OK;
+	SysCtrl_systemClock runClock = g_sysCtrlSystemClock;
+	unsigned long wakeStart;
+	unsigned char usesPll;
+
+	if (g_pendingClockConfig != (void *)0)
+	{
+		return SYSCTRL_E_PENDING;
+	}
+
+	usesPll = (g_sysCtrlConfigurations != (void *)0) && (PLL_OPERATING_NORMALLY == g_sysCtrlConfigurations->plluse);
+	if (usesPll)
+	{
+		SYSCTRL_REG_MODIFY(SYSCTL_RCC2_R_OFFSET, 0, (1 << BYPASS2));
+	}
+
+	g_powerStats.deepSleepCount++;
+	SYSCTRL_TRACE_EVENT(SYSCTRL_TRACE_SLEEP, SYSCTRL_POWER_MODE_DEEP_SLEEP, 0);
+	g_wakeMarked = 0;
+	SYSCTRL_WAIT_FOR_INTERRUPT(1);
+	wakeStart = SysCtrl_wakeStart();
+
+	if (usesPll)
+	{
+		g_pllLockStart = wakeStart;
+		g_pllAttemptStart = wakeStart;
+		g_pllAttempt = 0;
+
+		status = SysCtrl_waitPllLock();
+		if (status == SYSCTRL_E_OK)
+		{
+			SysCtrl_completeClockSwitch(g_sysCtrlConfigurations);
+		}
+		else
+		{
+			/*Degrade To A Slower Known Clock*/
+			SysCtrl_notifyClockChange(SYSCTRL_CLOCK_CHANGE_PRE, runClock, sysCtrl_FallbackConfig.achievedClock);
+			g_sysCtrlConfigurations = &sysCtrl_FallbackConfig;
+			(void)SysCtrl_beginClockSwitch(g_sysCtrlConfigurations);
+			SysCtrl_completeClockSwitch(g_sysCtrlConfigurations);
+			SysCtrl_notifyClockChange(SYSCTRL_CLOCK_CHANGE_POST, runClock, g_sysCtrlSystemClock);
+		}
+	}
+
+	SysCtrl_recordWake(wakeStart);
+	SYSCTRL_TRACE_EVENT(SYSCTRL_TRACE_WAKE, SYSCTRL_POWER_MODE_DEEP_SLEEP, g_powerStats.lastWakeCycles);
+	return status;
+}
+
+/******************************************************************************
+* \Syntax          : void SysCtrl_getPowerStats(SysCtrl_powerStatsType *stats_ptr)
+* \Description     : Read Low Power Entry Counts And Wake Latency
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): stats_ptr -> copy of the statistics
+*******************************************************************************/
+void SysCtrl_getPowerStats(SysCtrl_powerStatsType *stats_ptr)
+{
+	if (stats_ptr != (void *)0)
+	{
+		*stats_ptr = g_powerStats;
+	}
+}
+
+/******************************************************************************
+* \Syntax          : void SysCtrl_moscFailHandler(void)
+* \Description     : System Control Interrupt Handler Part For Main Oscillator Failure .. call from the
+*                    SYSCTL ISR (SYSCTRL_MOSC_MONITOR_FAILOVER). A system clock taken from MOSC is moved
+*                    to sysCtrl_MoscFailoverConfig (sysCtrl_FallbackConfig if its PLL does not lock),
+*                    listeners are notified and MOSC configurations are refused until
+*                    SysCtrl_clearMoscFailure. The PLL lock wait runs inside the ISR.
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+*******************************************************************************/
+void SysCtrl_moscFailHandler(void)
+{
+	SysCtrl_systemClock oldClock = g_sysCtrlSystemClock;
+
+	if ((SYSCTL_REG_READ(SYSCTL_MISC_R_OFFSET) & (1 << MOFRIS)) == 0)
+	{
+		return;
+	}
+	SYSCTL_REG_WRITE(SYSCTL_MISC_R_OFFSET, (1 << MOFRIS));
+
+	SYSCTRL_TRACE_EVENT(SYSCTRL_TRACE_MOSC_FAILURE, 0, oldClock);
+	g_moscStatus.failureCount++;
+	g_moscStatus.lastFailureCycles = SYSCTRL_CYCLE_COUNT();
+	g_moscStatus.failedOver = 1;
+
+	if (g_pendingClockConfig != (void *)0)
+	{
+		/*Drop A Clock Switch Still Waiting For Lock*/
+		SYSCTL_REG_MODIFY(SYSCTL_IMC_R_OFFSET, (1 << PLLLRIS), 0);
+		oldClock = g_pendingClockOldClock;
+		g_pendingClockConfig = (void *)0;
+		g_clockReadyCallback = (void *)0;
+	}
+	else if ((g_sysCtrlConfigurations == (void *)0) ||
+	         (CLOCK_SOURCE_MAIN_OSCILLATOR != g_sysCtrlConfigurations->clocksource))
+	{
+		return; /*System Clock Does Not Depend On MOSC*/
+	}
+
+	SysCtrl_notifyClockChange(SYSCTRL_CLOCK_CHANGE_PRE, oldClock, sysCtrl_MoscFailoverConfig.achievedClock);
+	(void)SysCtrl_applyClock(&sysCtrl_MoscFailoverConfig);
+	g_activeProfile = SYSCTRL_NUM_OF_PROFILES;
+	SysCtrl_notifyClockChange(SYSCTRL_CLOCK_CHANGE_POST, oldClock, g_sysCtrlSystemClock);
+}
+
+/******************************************************************************
+* \Syntax          : void SysCtrl_getMoscStatus(SysCtrl_moscStatusType *status_ptr)
+* \Description     : Read The Main Oscillator Failure Record
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): status_ptr -> copy of the record
+*******************************************************************************/
+void SysCtrl_getMoscStatus(SysCtrl_moscStatusType *status_ptr)
+{
+	if (status_ptr != (void *)0)
+	{
+		*status_ptr = g_moscStatus;
+	}
+}
+
+/******************************************************************************
+* \Syntax          : void SysCtrl_clearMoscFailure(void)
+* \Description     : Allow MOSC Configurations Again Once The Crystal Is Trusted
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+*******************************************************************************/
+void SysCtrl_clearMoscFailure(void)
+{
+	g_moscStatus.failedOver = 0;
+}
+
+/******************************************************************************
+* \Syntax          : static void SysCtrl_enableAutoClockGating(void)
+* \Description     : Make Sleep And Deep-Sleep Use SCGCx / DCGCx Instead Of RCGCx (RCC ACG)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+*******************************************************************************/
+static void SysCtrl_enableAutoClockGating(void)
+{
+	if (!g_autoClockGating)
+	{
+		SYSCTRL_REG_MODIFY(SYSCTL_RCC_R_OFFSET, 0, (1UL << ACG));
+		g_autoClockGating = 1;
+	}
+}
+
+/******************************************************************************
+* \Syntax          : void SysCtrl_markWake(void)
+* \Description     : Stamp The Wake .. call first thing in the wake interrupt handler. Without it the
+*                    wake is stamped when WFI returns, after the handler has run, and its time is
+*                    missing from the wake latency.
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+*******************************************************************************/
+void SysCtrl_markWake(void)
+{
+	/*Only The First Interrupt After WFI Is The Wake*/
+	if (!g_wakeMarked)
+	{
+		g_wakeStamp = SYSCTRL_CYCLE_COUNT();
+		g_wakeMarked = 1;
+	}
+}
+
+/******************************************************************************
+* \Syntax          : static unsigned long SysCtrl_wakeStart(void)
+* \Description     : Cycle Count The Core Woke At .. the SysCtrl_markWake stamp, else now (WFI returned)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): wake cycle count
+*******************************************************************************/
+static unsigned long SysCtrl_wakeStart(void)
+{
+	unsigned long now = SYSCTRL_CYCLE_COUNT();
+
+	return g_wakeMarked ? g_wakeStamp : now;
+}
+
+/******************************************************************************
+* \Syntax          : static void SysCtrl_recordWake(unsigned long wakeStart)
+* \Description     : Record Sleep / Deep-Sleep Wake Latency
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : wakeStart -> cycle count when the core resumed
+* \Parameters (out): None
+*******************************************************************************/
+static void SysCtrl_recordWake(unsigned long wakeStart)
+{
+	g_powerStats.lastWakeCycles = SYSCTRL_CYCLE_COUNT() - wakeStart;
+	if (g_powerStats.lastWakeCycles > g_powerStats.maxWakeCycles)
+	{
+		g_powerStats.maxWakeCycles = g_powerStats.lastWakeCycles;
+	}
+}
+
+/******************************************************************************
+* \Syntax          :SysCtrl_resetCauseType SysCtrl_getResetCause (void)     
+* \Description     : Detecet a reset cause since the previous power-on reset. RESC is cleared on the
+*                    first read and the causes are latched, so every caller sees them.
+* \Sync\Async      : Synchronous                                               
+* \Reentrancy      : non Reentrant                                             
+* \Parameters (in) : None
+* \Parameters (out): reset Cause                                                                                   
+*******************************************************************************/
+SysCtrl_resetCauseType SysCtrl_getResetCause (void)
+{
+	/*Read Reset Cause */
+	SysCtrl_resetCauseType resetCause = SYSCTL_REG_READ(SYSCTL_RESC_R_OFFSET) ; 
+	
+	if (resetCause != 0)
+	{
+		/*Clear Reset Cause*/
+		SYSCTL_REG_WRITE(SYSCTL_RESC_R_OFFSET, 0) ; /*Writing a 0 to any reset cause clears it.*/
+		g_resetCause |= resetCause;
+	}
+	
+	/*Return Reset Cause*/
+	return g_resetCause ; 
+}
+
+/******************************************************************************
+* \Syntax          : SysCtrl_pllStatusType SysCtrl_getPllStatus( void ) 
+* \Description     : get Current PLL Status either "POWERED/LOCKED" OR"UNPOWERD/UNLOCKED"                                                                                              
+* \Sync\Async      : Synchronous                                               
+* \Reentrancy      : non Reentrant                                             
+* \Parameters (in) : None
+* \Parameters (out): reset Cause                                                                                   
+*******************************************************************************/
+SysCtrl_pllStatusType SysCtrl_getPllStatus( void )
+{
+	SysCtrl_pllStatusType currentPllStatus=((SYSCTL_REG_READ(SYSCTL_PLLSTAT_R_OFFSET) ==0) ? PLL_IS_UNLOCKED : PLL_IS_LOCKED); 
+	return currentPllStatus ; 
+}
+
+/******************************************************************************
+* \Syntax          : void SysCtrl_captureState(SysCtrl_snapshotType *snapshot_ptr)
+* \Description     : Copy RCC, RCC2, RIS, PLLSTAT, RESC And The RCGC/SCGC/DCGC/PR Gates Into A
+*                    92 Byte Record .. hardware is read directly (not the shadow), RESC is not cleared
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): snapshot_ptr -> captured state
+*******************************************************************************/
+void SysCtrl_captureState(SysCtrl_snapshotType *snapshot_ptr)
+{
+	static const unsigned long regOffset[SYSCTRL_SNAPSHOT_REGS] =
+	{
+		SYSCTL_RCC_R_OFFSET, SYSCTL_RCC2_R_OFFSET, SYSCTL_RIS_R_OFFSET, SYSCTL_PLLSTAT_R_OFFSET, SYSCTL_RESC_R_OFFSET
+	};
+	static const unsigned long gateOffset[SYSCTRL_SNAPSHOT_GATE_BLOCKS] =
+	{
+		SYSCTL_RCGC_OFFSET, SYSCTL_SCGC_OFFSET, SYSCTL_DCGC_OFFSET, SYSCTL_PR_OFFSET
+	};
+	unsigned long value;
+	unsigned char index;
+	unsigned char periphral;
+
+	if (snapshot_ptr == (void *)0)
+	{
+		return;
+	}
+
+	value = SYSCTRL_CYCLE_COUNT();
+	snapshot_ptr->magic[0] = SYSCTRL_SNAPSHOT_MAGIC_0;
+	snapshot_ptr->magic[1] = SYSCTRL_SNAPSHOT_MAGIC_1;
+	snapshot_ptr->version = SYSCTRL_SNAPSHOT_VERSION;
+	snapshot_ptr->size = sizeof(SysCtrl_snapshotType);
+	for (index = 0; index < 4; index++)
+	{
+		snapshot_ptr->timestamp[index] = (unsigned char)(value >> (index * 8));
+	}
+
+	for (index = 0; index < SYSCTRL_SNAPSHOT_REGS; index++)
+	{
+		value = SYSCTL_REG_READ(regOffset[index]);
+		snapshot_ptr->reg[index][0] = (unsigned char)value;
+		snapshot_ptr->reg[index][1] = (unsigned char)(value >> 8);
+		snapshot_ptr->reg[index][2] = (unsigned char)(value >> 16);
+		snapshot_ptr->reg[index][3] = (unsigned char)(value >> 24);
+	}
+
+	/*Every Gate Register Holds At Most SYSCTRL_MAX_PERIPHRAL_INSTANCES (8) Instance Bits*/
+	for (index = 0; index < SYSCTRL_SNAPSHOT_GATE_BLOCKS; index++)
+	{
+		for (periphral = 0; periphral < SYSCTRL_NUM_OF_PERIPHRALS; periphral++)
+		{
+			snapshot_ptr->gate[index][periphral] =
+				(unsigned char)SYSCTL_REG_READ(gateOffset[index] + g_RcgPreiphralOfsset[periphral]);
+		}
+	}
+}
+
+/******************************************************************************
+* \Syntax          : unsigned short SysCtrl_snapshotDiff(const SysCtrl_snapshotType *old_ptr,
+*                                       const SysCtrl_snapshotType *new_ptr, SysCtrl_snapshotType *diff_ptr)
+* \Description     : Compare Two Snapshots .. RAM only, no register access
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : old_ptr, new_ptr -> snapshots to compare
+* \Parameters (out): diff_ptr -> changed bits (XOR of both records, header taken from new_ptr), may be NULL
+*                    SYSCTRL_SNAPSHOT_REG_CHANGED / SYSCTRL_SNAPSHOT_GATE_CHANGED bits (0 -> identical)
+*******************************************************************************/
+unsigned short SysCtrl_snapshotDiff(const SysCtrl_snapshotType *old_ptr, const SysCtrl_snapshotType *new_ptr, SysCtrl_snapshotType *diff_ptr)
+{
+	unsigned short changed = 0;
+	unsigned char delta;
+	unsigned char index;
+	unsigned char byte;
+
+	if ((old_ptr == (void *)0) || (new_ptr == (void *)0))
+	{
+		return 0;
+	}
+
+	if (diff_ptr != (void *)0)
+	{
+		*diff_ptr = *new_ptr;
+	}
+
+	for (index = 0; index < SYSCTRL_SNAPSHOT_REGS; index++)
+	{
+		for (byte = 0; byte < 4; byte++)
+		{
+			delta = old_ptr->reg[index][byte] ^ new_ptr->reg[index][byte];
+			changed |= (delta != 0) ? SYSCTRL_SNAPSHOT_REG_CHANGED(index) : 0;
+			if (diff_ptr != (void *)0)
+			{
+				diff_ptr->reg[index][byte] = delta;
+			}
+		}
+	}
+
+	for (index = 0; index < SYSCTRL_SNAPSHOT_GATE_BLOCKS; index++)
+	{
+		for (byte = 0; byte < SYSCTRL_NUM_OF_PERIPHRALS; byte++)
+		{
+			delta = old_ptr->gate[index][byte] ^ new_ptr->gate[index][byte];
+			changed |= (delta != 0) ? SYSCTRL_SNAPSHOT_GATE_CHANGED(index) : 0;
+			if (diff_ptr != (void *)0)
+			{
+				diff_ptr->gate[index][byte] = delta;
+			}
+		}
+	}
+	return changed;
+}
+
+/******************************************************************************
+* \Syntax          : unsigned long SysCtrl_snapshotReg(const SysCtrl_snapshotType *snapshot_ptr, unsigned char reg)
+* \Description     : Register Value Held In A Snapshot
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : snapshot_ptr -> snapshot / reg -> SYSCTRL_SNAPSHOT_RCC .. SYSCTRL_SNAPSHOT_RESC
+* \Parameters (out): register value (0 -> unknown register)
+*******************************************************************************/
+unsigned long SysCtrl_snapshotReg(const SysCtrl_snapshotType *snapshot_ptr, unsigned char reg)
+{
+	if ((snapshot_ptr == (void *)0) || (reg >= SYSCTRL_SNAPSHOT_REGS))
+	{
+		return 0;
+	}
+	return (unsigned long)snapshot_ptr->reg[reg][0] | ((unsigned long)snapshot_ptr->reg[reg][1] << 8) |
+	       ((unsigned long)snapshot_ptr->reg[reg][2] << 16) | ((unsigned long)snapshot_ptr->reg[reg][3] << 24);
+}
+
+/******************************************************************************
+* \Syntax          : void SysCtrl_peripheralEnable(SysCtrl_systemPeriphralType periphral ,SysCtrl_periphralInstanceType instance)
+* \Description     : enable Clock Gate For Any Periphral instance                                                                                             
+* \Sync\Async      : Synchronous                                               
+* \Reentrancy      : non Reentrant                                             
+* \Parameters (in) : periphral / perphiral instance 
+* \Parameters (out): None                                                                                   
+*******************************************************************************/
+void SysCtrl_peripheralEnable(SysCtrl_systemPeriphralType periphral ,SysCtrl_periphralInstanceType instance)
+{
+	SYSCTRL_GATE_BIT_SET(SYSCTL_RCGC_OFFSET+g_RcgPreiphralOfsset[periphral], instance) ; 
+	SYSCTRL_TRACE_EVENT(SYSCTRL_TRACE_GATE_ENABLE, periphral, (1UL << instance));
+}
+/******************************************************************************
+* \Syntax          : void SysCtrl_peripheralDisable(SysCtrl_systemPeriphralType periphral ,SysCtrl_periphralInstanceType instance)
+* \Description     : Disable Clock Gate For Any Periphral instance .. an instance held through
+*                    SysCtrl_peripheralAcquire stays open until its last SysCtrl_peripheralRelease
+* \Sync\Async      : Synchronous                                               
+* \Reentrancy      : non Reentrant                                             
+* \Parameters (in) : periphral / perphiral instance 
+* \Parameters (out): None                                                                                   
+*******************************************************************************/
+
+void SysCtrl_peripheralDisable(SysCtrl_systemPeriphralType periphral ,SysCtrl_periphralInstanceType instance)
+{
+	if ((instance < SYSCTRL_MAX_PERIPHRAL_INSTANCES) && (g_gateHeld[periphral] & (1UL << instance)))
+	{
+		return; /*Held Through SysCtrl_peripheralAcquire .. closed by the last SysCtrl_peripheralRelease*/
+	}
+	SYSCTRL_GATE_BIT_CLEAR(SYSCTL_RCGC_OFFSET+g_RcgPreiphralOfsset[periphral], instance) ; 
+	SYSCTRL_TRACE_EVENT(SYSCTRL_TRACE_GATE_DISABLE, periphral, (1UL << instance));
+}
+
+/******************************************************************************
+* \Syntax          : SysCtrl_returnType SysCtrl_peripheralEnableSet(const SysCtrl_periphralSetType *set_ptr)
+* \Description     : Enable Clock Gates For A Set Of Periphral instances .. one write per RCGC
+*                    register, then one bounded wait until all PRxxx ready bits are set
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : set_ptr -> periphral instances to enable
+* \Parameters (out): SYSCTRL_E_OK / SYSCTRL_E_NOT_OK / SYSCTRL_E_TIMEOUT
+*******************************************************************************/
+SysCtrl_returnType SysCtrl_peripheralEnableSet(const SysCtrl_periphralSetType *set_ptr)
+{
+	unsigned long pendingMask[SYSCTRL_NUM_OF_PERIPHRALS];
+	unsigned long pending = 0;
+	unsigned long timeout = SYSCTRL_PERIPHERAL_READY_TIMEOUT;
+	unsigned char periphral;
+
+	if (set_ptr == (void *)0)
+	{
+		return SYSCTRL_E_NOT_OK;
+	}
+
+	/*Open All Gates*/
+	for (periphral = 0; periphral < SYSCTRL_NUM_OF_PERIPHRALS; periphral++)
+	{
+		pendingMask[periphral] = set_ptr->instanceMask[periphral];
+		if (pendingMask[periphral] != 0)
+		{
+			SYSCTRL_GATE_MASK_SET(SYSCTL_RCGC_OFFSET + g_RcgPreiphralOfsset[periphral], pendingMask[periphral]);
+			SYSCTRL_TRACE_EVENT(SYSCTRL_TRACE_GATE_ENABLE, periphral, pendingMask[periphral]);
+			pending++;
+		}
+	}
+
+	/*Wait Once For All Periphrals To Become Ready*/
+	while (pending != 0)
+	{
+		if (timeout == 0)
+		{
+			return SYSCTRL_E_TIMEOUT;
+		}
+		timeout--;
+
+		for (periphral = 0; periphral < SYSCTRL_NUM_OF_PERIPHRALS; periphral++)
+		{
+			if ((pendingMask[periphral] != 0) &&
+			    ((SYSCTL_REG_READ(SYSCTL_PR_OFFSET + g_RcgPreiphralOfsset[periphral]) & pendingMask[periphral]) == pendingMask[periphral]))
+			{
+				SYSCTRL_TRACE_EVENT(SYSCTRL_TRACE_PERIPHERAL_READY, periphral, pendingMask[periphral]);
+				pendingMask[periphral] = 0;
+				pending--;
+			}
+		}
+	}
+	return SYSCTRL_E_OK;
+}
+
+/******************************************************************************
+* \Syntax          : void SysCtrl_peripheralDisableSet(const SysCtrl_periphralSetType *set_ptr)
+* \Description     : Disable Clock Gates For A Set Of Periphral instances .. one write per RCGC register,
+*                    acquired instances stay open
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : set_ptr -> periphral instances to disable
+* \Parameters (out): None
+*******************************************************************************/
+void SysCtrl_peripheralDisableSet(const SysCtrl_periphralSetType *set_ptr)
+{
+	unsigned long gatesOff;
+	unsigned char periphral;
+
+	if (set_ptr != (void *)0)
+	{
+		for (periphral = 0; periphral < SYSCTRL_NUM_OF_PERIPHRALS; periphral++)
+		{
+			/*Acquired Instances Stay Open*/
+			gatesOff = set_ptr->instanceMask[periphral] & ~g_gateHeld[periphral];
+			if (gatesOff != 0)
+			{
+				SYSCTRL_GATE_MASK_CLEAR(SYSCTL_RCGC_OFFSET + g_RcgPreiphralOfsset[periphral], gatesOff);
+				SYSCTRL_TRACE_EVENT(SYSCTRL_TRACE_GATE_DISABLE, periphral, gatesOff);
+			}
+		}
+	}
+}
+
+/******************************************************************************
+* \Syntax          : SysCtrl_returnType SysCtrl_peripheralRecoverSet(const SysCtrl_periphralSetType *set_ptr,
+*                                       SysCtrl_recoverActionType action, SysCtrl_recoverTimingType *timing_ptr)
+* \Description     : Reset (Or Power Cycle) A Set Of Periphral instances In One Batched Sequence .. assert
+*                    SRxxx, hold SYSCTRL_PERIPHERAL_RESET_HOLD_CYCLES, release, then wait once for PRxxx.
+*                    One RCGC read plus one write per SR / RCGC register touched. Only gates open on entry
+*                    are power cycled and reopened, and only those instances are waited for .. a gated off
+*                    instance is reset but stays off. Gate reference counts are not changed.
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : set_ptr -> periphral instances to recover / action -> reset or power cycle
+* \Parameters (out): timing_ptr -> core cycles per step (may be NULL)
+*                    SYSCTRL_E_OK / SYSCTRL_E_NOT_OK / SYSCTRL_E_TIMEOUT (an instance did not get ready)
+*******************************************************************************/
+SysCtrl_returnType SysCtrl_peripheralRecoverSet(const SysCtrl_periphralSetType *set_ptr, SysCtrl_recoverActionType action, SysCtrl_recoverTimingType *timing_ptr)
+{
+	SysCtrl_recoverTimingType timing = {0, 0, 0, 0};
+	SysCtrl_returnType status = SYSCTRL_E_OK;
+	unsigned long pendingMask[SYSCTRL_NUM_OF_PERIPHRALS];
+	unsigned long openMask[SYSCTRL_NUM_OF_PERIPHRALS];
+	unsigned long asserted = 0;
+	unsigned long pending = 0;
+	unsigned long timeout = SYSCTRL_PERIPHERAL_READY_TIMEOUT;
+	unsigned long holdOffset = SYSCTL_SR_OFFSET;
+	unsigned long holdReads = 0;
+	unsigned long stepStart;
+	unsigned char periphral;
+
+	if ((set_ptr == (void *)0) || ((action != SYSCTRL_RECOVER_RESET) && (action != SYSCTRL_RECOVER_POWER_CYCLE)))
+	{
+		return SYSCTRL_E_NOT_OK;
+	}
+
+	/*Steps Are Timed In Core Cycles*/
+	SYSCTRL_CYCLE_COUNTER_ENABLE();
+
+	/*Assert Reset*/
+	stepStart = SYSCTRL_CYCLE_COUNT();
+	for (periphral = 0; periphral < SYSCTRL_NUM_OF_PERIPHRALS; periphral++)
+	{
+		openMask[periphral] = 0;
+		pendingMask[periphral] = 0;
+		if (set_ptr->instanceMask[periphral] != 0)
+		{
+			/*PRxxx Never Sets For A Gated Off Instance .. only open gates are cycled and waited for*/
+			openMask[periphral] = SYSCTL_REG_READ(SYSCTL_RCGC_OFFSET + g_RcgPreiphralOfsset[periphral]) & set_ptr->instanceMask[periphral];
+			pendingMask[periphral] = openMask[periphral];
+			if ((SYSCTRL_RECOVER_POWER_CYCLE == action) && (openMask[periphral] != 0))
+			{
+				SYSCTRL_GATE_MASK_CLEAR(SYSCTL_RCGC_OFFSET + g_RcgPreiphralOfsset[periphral], openMask[periphral]);
+				SYSCTRL_TRACE_EVENT(SYSCTRL_TRACE_GATE_DISABLE, periphral, openMask[periphral]);
+			}
+			SYSCTL_REG_MODIFY(SYSCTL_SR_OFFSET + g_RcgPreiphralOfsset[periphral], 0, set_ptr->instanceMask[periphral]);
+			SYSCTRL_TRACE_EVENT(SYSCTRL_TRACE_RESET_ASSERT, periphral, set_ptr->instanceMask[periphral]);
+			holdOffset = SYSCTL_SR_OFFSET + g_RcgPreiphralOfsset[periphral];
+			asserted++;
+			pending += (openMask[periphral] != 0);
+		}
+	}
+	timing.assertCycles = SYSCTRL_CYCLE_COUNT() - stepStart;
+
+	if (asserted != 0)
+	{
+		/*Hold .. reading SR back also makes sure the last assert has reached the bus.
+		  A read takes at least one core cycle, so the read count bounds the hold if the counter is stopped*/
+		stepStart = SYSCTRL_CYCLE_COUNT();
+		do
+		{
+			(void)SYSCTL_REG_READ(holdOffset);
+			holdReads++;
+		} while (((SYSCTRL_CYCLE_COUNT() - stepStart) < SYSCTRL_PERIPHERAL_RESET_HOLD_CYCLES) &&
+		         (holdReads < SYSCTRL_PERIPHERAL_RESET_HOLD_CYCLES));
+		timing.holdCycles = SYSCTRL_CYCLE_COUNT() - stepStart;
+
+		/*Release .. a power cycled instance is clocked again before it leaves reset, only gates that were open reopen*/
+		stepStart = SYSCTRL_CYCLE_COUNT();
+		for (periphral = 0; periphral < SYSCTRL_NUM_OF_PERIPHRALS; periphral++)
+		{
+			if (set_ptr->instanceMask[periphral] != 0)
+			{
+				if ((SYSCTRL_RECOVER_POWER_CYCLE == action) && (openMask[periphral] != 0))
+				{
+					SYSCTRL_GATE_MASK_SET(SYSCTL_RCGC_OFFSET + g_RcgPreiphralOfsset[periphral], openMask[periphral]);
+					SYSCTRL_TRACE_EVENT(SYSCTRL_TRACE_GATE_ENABLE, periphral, openMask[periphral]);
+				}
+				SYSCTL_REG_MODIFY(SYSCTL_SR_OFFSET + g_RcgPreiphralOfsset[periphral], set_ptr->instanceMask[periphral], 0);
+				SYSCTRL_TRACE_EVENT(SYSCTRL_TRACE_RESET_RELEASE, periphral, set_ptr->instanceMask[periphral]);
+			}
+		}
+		timing.releaseCycles = SYSCTRL_CYCLE_COUNT() - stepStart;
+
+		/*Wait Once For All Periphrals To Become Ready*/
+		stepStart = SYSCTRL_CYCLE_COUNT();
+		while (pending != 0)
+		{
+			if (timeout == 0)
+			{
+				status = SYSCTRL_E_TIMEOUT;
+				break;
+			}
+			timeout--;
+
+			for (periphral = 0; periphral < SYSCTRL_NUM_OF_PERIPHRALS; periphral++)
+			{
+				if ((pendingMask[periphral] != 0) &&
+				    ((SYSCTL_REG_READ(SYSCTL_PR_OFFSET + g_RcgPreiphralOfsset[periphral]) & pendingMask[periphral]) == pendingMask[periphral]))
+				{
+					SYSCTRL_TRACE_EVENT(SYSCTRL_TRACE_PERIPHERAL_READY, periphral, pendingMask[periphral]);
+					pendingMask[periphral] = 0;
+					pending--;
+				}
+			}
+		}
+		timing.readyCycles = SYSCTRL_CYCLE_COUNT() - stepStart;
+	}
+
+	if (timing_ptr != (void *)0)
+	{
+		*timing_ptr = timing;
+	}
+	return status;
+}
+
+/******************************************************************************
+* \Syntax          : SysCtrl_returnType SysCtrl_peripheralAcquire(SysCtrl_systemPeriphralType periphral,
+*                                       SysCtrl_periphralInstanceType instance, SysCtrl_gateOwnerType owner)
+* \Description     : Take A Reference On A Periphral Clock Gate .. the gate opens for the first user
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : periphral / perphiral instance / owner -> calling driver (tracked in debug builds)
+* \Parameters (out): SYSCTRL_E_OK / SYSCTRL_E_NOT_OK
+*******************************************************************************/
+SysCtrl_returnType SysCtrl_peripheralAcquire(SysCtrl_systemPeriphralType periphral, SysCtrl_periphralInstanceType instance, SysCtrl_gateOwnerType owner)
+{
+	if ((periphral >= SYSCTRL_NUM_OF_PERIPHRALS) || (instance >= SYSCTRL_MAX_PERIPHRAL_INSTANCES) ||
+	    (g_gateRefCount[periphral][instance] == 0xFF))
+	{
+		return SYSCTRL_E_NOT_OK;
+	}
+
+#if (SYSCTRL_GATE_OWNER_TRACKING == 1U)
+	if ((owner >= 32) || (g_gateOwners[periphral][instance] & (1UL << owner)))
+	{
+		return SYSCTRL_E_NOT_OK; /*Unknown Owner Or Already Holding This Gate*/
+	}
+	g_gateOwners[periphral][instance] |= (1UL << owner);
+#else
+	(void)owner;
+#endif
+
+	if (g_gateRefCount[periphral][instance]++ == 0)
+	{
+		g_gateHeld[periphral] |= (1UL << instance);
+		SysCtrl_peripheralEnable(periphral, instance);
+	}
+	return SYSCTRL_E_OK;
+}
+
+/******************************************************************************
+* \Syntax          : SysCtrl_returnType SysCtrl_peripheralRelease(SysCtrl_systemPeriphralType periphral,
+*                                       SysCtrl_periphralInstanceType instance, SysCtrl_gateOwnerType owner)
+* \Description     : Drop A Reference On A Periphral Clock Gate .. the gate closes when the last user leaves
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : periphral / perphiral instance / owner -> calling driver (tracked in debug builds)
+* \Parameters (out): SYSCTRL_E_OK / SYSCTRL_E_NOT_OK (gate not held)
+*******************************************************************************/
+SysCtrl_returnType SysCtrl_peripheralRelease(SysCtrl_systemPeriphralType periphral, SysCtrl_periphralInstanceType instance, SysCtrl_gateOwnerType owner)
+{
+	if ((periphral >= SYSCTRL_NUM_OF_PERIPHRALS) || (instance >= SYSCTRL_MAX_PERIPHRAL_INSTANCES) ||
+	    (g_gateRefCount[periphral][instance] == 0))
+	{
+		return SYSCTRL_E_NOT_OK;
+	}
+
+#if (SYSCTRL_GATE_OWNER_TRACKING == 1U)
+	if ((owner >= 32) || ((g_gateOwners[periphral][instance] & (1UL << owner)) == 0))
+	{
+		return SYSCTRL_E_NOT_OK; /*Releasing A Gate This Owner Does Not Hold*/
+	}
+	g_gateOwners[periphral][instance] &= ~(1UL << owner);
+#else
+	(void)owner;
+#endif
+
+	if (--g_gateRefCount[periphral][instance] == 0)
+	{
+		g_gateHeld[periphral] &= ~(1UL << instance);
+		SysCtrl_peripheralDisable(periphral, instance);
+	}
+	return SYSCTRL_E_OK;
+}
+
+/******************************************************************************
+* \Syntax          : unsigned char SysCtrl_getPeripheralUsers(SysCtrl_systemPeriphralType periphral,
+*                                       SysCtrl_periphralInstanceType instance)
+* \Description     : Number Of Users Currently Holding A Periphral Clock Gate
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : periphral / perphiral instance
+* \Parameters (out): reference count
+*******************************************************************************/
+unsigned char SysCtrl_getPeripheralUsers(SysCtrl_systemPeriphralType periphral, SysCtrl_periphralInstanceType instance)
+{
+	if ((periphral >= SYSCTRL_NUM_OF_PERIPHRALS) || (instance >= SYSCTRL_MAX_PERIPHRAL_INSTANCES))
+	{
+		return 0;
+	}
+	return g_gateRefCount[periphral][instance];
+}
+
+#if (SYSCTRL_GATE_OWNER_TRACKING == 1U)
+/******************************************************************************
+* \Syntax          : unsigned long SysCtrl_getPeripheralOwners(SysCtrl_systemPeriphralType periphral,
+*                                       SysCtrl_periphralInstanceType instance)
+* \Description     : Owners Currently Holding A Periphral Clock Gate (Debug)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : periphral / perphiral instance
+* \Parameters (out): owner bit mask
+*******************************************************************************/
+unsigned long SysCtrl_getPeripheralOwners(SysCtrl_systemPeriphralType periphral, SysCtrl_periphralInstanceType instance)
+{
+	if ((periphral >= SYSCTRL_NUM_OF_PERIPHRALS) || (instance >= SYSCTRL_MAX_PERIPHRAL_INSTANCES))
+	{
+		return 0;
+	}
+	return g_gateOwners[periphral][instance];
+}
+#endif
+
+/******************************************************************************
+* \Syntax          : static SysCtrl_returnType SysCtrl_beginClockSwitch(const SysCtrl_configType *config_ptr)
+* \Description     : Program Source, Crystal, PLL Power And Divisor While The PLL Is Bypassed
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : config_ptr -> resolved clock configuration
+* \Parameters (out): SYSCTRL_E_OK / SYSCTRL_E_TIMEOUT (main oscillator never powered up, source left unchanged)
+*******************************************************************************/
+static SysCtrl_returnType SysCtrl_beginClockSwitch(const SysCtrl_configType *config_ptr)
+{
+	unsigned long waitStart;
+	unsigned char moscPowerUp = (!g_moscPowered) && ((config_ptr->rccImage & SYSCTRL_RCC_MOSCDIS) == 0);
+
+	/*Lock And Power-Up Timeouts Are Measured In Core Cycles .. every switch path passes through here*/
+	SYSCTRL_CYCLE_COUNTER_ENABLE();
+
+	/*Use RCC2 To Extend RCC Functions And Run From The Raw Oscillator While Source And Divisor Change*/
+	SYSCTRL_REG_MODIFY(SYSCTL_RCC2_R_OFFSET, 0, (SYSCTL_RCC2_USERCC2 | (1 << BYPASS2))); /*Writing in RCC2 Overrides RCC*/
+
+	if (moscPowerUp)
+	{
+		SYSCTL_REG_WRITE(SYSCTL_MISC_R_OFFSET, (1 << MOSCPUPRIS));
+	}
+
+	/*Attached Crystal, Main Oscillator Enable And Divisor Usage*/
+	SYSCTRL_REG_MODIFY(SYSCTL_RCC_R_OFFSET, SYSCTRL_RCC_CLOCK_M, config_ptr->rccImage);
+	g_moscPowered = ((config_ptr->rccImage & SYSCTRL_RCC_MOSCDIS) == 0);
+
+	/*A Crystal Is Selected Only After It Powered Up .. a dead one is recorded and left unselected for the caller to fall back*/
+	if (moscPowerUp)
+	{
+		waitStart = SYSCTRL_CYCLE_COUNT();
+		while ((SYSCTL_REG_READ(SYSCTL_RIS_R_OFFSET) & (1 << MOSCPUPRIS)) == 0)
+		{
+			if ((SYSCTRL_CYCLE_COUNT() - waitStart) >= SYSCTRL_MOSC_POWER_UP_TIMEOUT_CYCLES)
+			{
+				g_moscStatus.failureCount++;
+				g_moscStatus.lastFailureCycles = SYSCTRL_CYCLE_COUNT();
+				g_moscPowered = 0;
+				SYSCTRL_TRACE_EVENT(SYSCTRL_TRACE_MOSC_FAILURE, 0, g_sysCtrlSystemClock);
+				return SYSCTRL_E_TIMEOUT;
+			}
+		}
+	}
+
+	/*Oscillator Source, PLL Power And Divisor .. Still Bypassed*/
+	SYSCTRL_REG_WRITE(SYSCTL_RCC2_R_OFFSET, (config_ptr->rcc2Image | (1 << BYPASS2)));
+	SYSCTRL_TRACE_EVENT(SYSCTRL_TRACE_CLOCK_SOURCE_SET, config_ptr->clocksource, config_ptr->rcc2Image);
+	if (PLL_OPERATING_NORMALLY == config_ptr->plluse)
+	{
+		SYSCTRL_TRACE_EVENT(SYSCTRL_TRACE_PLL_POWER_UP, 0, 0);
+	}
+
+	g_pllLockStart = SYSCTRL_CYCLE_COUNT();
+	g_pllAttemptStart = g_pllLockStart;
+	g_pllAttempt = 0;
+	return SYSCTRL_E_OK;
+}
+
+/******************************************************************************
+* \Syntax          : static SysCtrl_returnType SysCtrl_applyClock(const SysCtrl_configType *config_ptr)
+* \Description     : Select A Resolved Clock Configuration, Falling Back When The Main Oscillator
+*                    Does Not Power Up Or The PLL Fails To Lock
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : config_ptr -> resolved clock configuration
+* \Parameters (out): SYSCTRL_E_OK / SYSCTRL_E_TIMEOUT (running on sysCtrl_FallbackConfig)
+*******************************************************************************/
+static SysCtrl_returnType SysCtrl_applyClock(const SysCtrl_configType *config_ptr)
+{
+	SysCtrl_returnType status;
+
+	/*Save Clock Configurations*/
+	g_sysCtrlConfigurations = config_ptr;
+
+	/*initilization Sequence .. register images are resolved at build time*/
+	status = SysCtrl_beginClockSwitch(g_sysCtrlConfigurations);
+
+	if ((status == SYSCTRL_E_OK) && (PLL_OPERATING_NORMALLY == g_sysCtrlConfigurations->plluse))
+	{
+		/*wait PLL to lock.*/
+		status = SysCtrl_waitPllLock();
+	}
+
+	if (status != SYSCTRL_E_OK)
+	{
+		/*Degrade To A Slower Known Clock Instead Of Hanging*/
+		g_sysCtrlConfigurations = &sysCtrl_FallbackConfig;
+		(void)SysCtrl_beginClockSwitch(g_sysCtrlConfigurations);
+	}
+
+	SysCtrl_completeClockSwitch(g_sysCtrlConfigurations);
+	return status;
+}
+
+/******************************************************************************
+* \Syntax          : static void SysCtrl_completeClockSwitch(const SysCtrl_configType *config_ptr)
+* \Description     : Select The Final Clock (removes BYPASS2 when the PLL is used)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : config_ptr -> resolved clock configuration
+* \Parameters (out): None
+*******************************************************************************/
+static void SysCtrl_completeClockSwitch(const SysCtrl_configType *config_ptr)
+{
+	if (PLL_OPERATING_NORMALLY == config_ptr->plluse)
+	{
+		/* select PLL as the source of system clock*/
+		SYSCTRL_REG_WRITE(SYSCTL_RCC2_R_OFFSET, config_ptr->rcc2Image);
+		SYSCTRL_TRACE_EVENT(SYSCTRL_TRACE_BYPASS_REMOVED, 0, config_ptr->achievedClock);
+	}
+
+	/*achievedClock Is Nominal .. PIOSC drift is applied here only*/
+	g_sysCtrlSystemClock = SysCtrl_pioscDerived(config_ptr) ? SysCtrl_pioscScaled(config_ptr->achievedClock) : config_ptr->achievedClock;
+	SysCtrl_updateClockCache();
+}
+
+/******************************************************************************
+* \Syntax          : static void SysCtrl_updateClockCache(void)
+* \Description     : Recompute Derived Clocks Once Per Clock Change
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+*******************************************************************************/
+static void SysCtrl_updateClockCache(void)
+{
+	g_pwmClock = g_sysCtrlSystemClock >> g_pwmDivShift;
+
+	/*USB PLL Runs When The Active Configuration Leaves USBPWRDN Clear*/
+	if ((g_sysCtrlConfigurations != (void *)0) && ((g_sysCtrlConfigurations->rcc2Image & SYSCTRL_RCC2_USBPWRDN) == 0))
+	{
+		g_usbClock = SYSCTRL_USB_HZ;
+	}
+	else
+	{
+		g_usbClock = 0;
+	}
+
+	/*Alternate Clock Of UART/SSI/Timer Instances*/
+	switch (g_altClockSource)
+	{
+	case SYSCTRL_ALT_CLOCK_RTCOSC:
+		g_altClock = SYSCTRL_XTAL32K_HZ;
+		break;
+	case SYSCTRL_ALT_CLOCK_LFIOSC:
+		g_altClock = SYSCTRL_LFIOSC_HZ;
+		break;
+	default:
+		g_altClock = g_pioscClock;
+		break;
+	}
+
+	/*ADC Runs From PLL VCO / 25 When The PLL Is Used, Otherwise From PIOSC*/
+	if ((g_sysCtrlConfigurations != (void *)0) && (PLL_OPERATING_NORMALLY == g_sysCtrlConfigurations->plluse))
+	{
+		g_adcClock = PLL_CLOCK_400 / 25;
+	}
+	else
+	{
+		g_adcClock = g_pioscClock;
+	}
+}
+
+/******************************************************************************
+* \Syntax          : static unsigned char SysCtrl_pioscDerived(const SysCtrl_configType *config_ptr)
+* \Description     : Does A System Clock Come From PIOSC (directly, divided or through the PLL)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : config_ptr -> clock configuration (NULL -> reset clock)
+* \Parameters (out): 1 -> PIOSC derived, 0 -> other oscillator
+*******************************************************************************/
+static unsigned char SysCtrl_pioscDerived(const SysCtrl_configType *config_ptr)
+{
+	/*Out Of Reset The Device Runs From PIOSC*/
+	return (config_ptr == (void *)0) ||
+	       (CLOCK_SOURCE_PRECISION_INTERNAL_OSCILLATOR == config_ptr->clocksource) ||
+	       (CLOCK_SOURCE_PRECISION_INTERNAL_OSCILLATOR_DIVDED_4 == config_ptr->clocksource);
+}
+
+/******************************************************************************
+* \Syntax          : static SysCtrl_systemClock SysCtrl_nominalOscillatorClock(SysCtrl_ClockSourceType clocksource,
+*                                       SysCtrl_ExternalCrystalValueType xtal)
+* \Description     : Data Sheet Oscillator Clock For A Clock Source .. what configurations are planned with
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : clocksource -> oscillator Clock Source / xtal -> Attached Crystal
+* \Parameters (out): oscillator clock in Hz
+*******************************************************************************/
+static SysCtrl_systemClock SysCtrl_nominalOscillatorClock(SysCtrl_ClockSourceType clocksource, SysCtrl_ExternalCrystalValueType xtal)
+{
+	SysCtrl_systemClock oscClock = PIOSC;
+
+	switch (clocksource)
+	{
+	case CLOCK_SOURCE_MAIN_OSCILLATOR:
+		oscClock = SysCtrl_getCrystalClock(xtal);
+		break;
+	case CLOCK_SOURCE_PRECISION_INTERNAL_OSCILLATOR_DIVDED_4:
+		oscClock = SYSCTRL_PIOSC_DIV_4_HZ;
+		break;
+	case CLOCK_SOURCE_LOW_FREQUENCY_INTERNAL_OSCILLATOR:
+		oscClock = SYSCTRL_LFIOSC_HZ;
+		break;
+	case CLOCK_SOURCE_HIBERNTION_OSCILLATOR:
+		oscClock = SYSCTRL_XTAL32K_HZ;
+		break;
+	default:
+		break;
+	}
+	return oscClock;
+}
+
+/******************************************************************************
+* \Syntax          : static SysCtrl_systemClock SysCtrl_pioscScaled(SysCtrl_systemClock nominalClock)
+* \Description     : Scale A Nominal PIOSC Derived Clock By The Last Measured PIOSC
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : nominalClock -> clock planned with a 16 MHz PIOSC
+* \Parameters (out): clock in Hz
+*******************************************************************************/
+static SysCtrl_systemClock SysCtrl_pioscScaled(SysCtrl_systemClock nominalClock)
+{
+	if (g_pioscClock == PIOSC)
+	{
+		return nominalClock;
+	}
+	return (SysCtrl_systemClock)(((unsigned long long)nominalClock * g_pioscClock) / PIOSC);
+}
+
+/******************************************************************************
+* \Syntax          : static SysCtrl_systemClock SysCtrl_measureClock(const SysCtrl_clockMeasureType *measure_ptr)
+* \Description     : One System Clock Measurement
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : measure_ptr -> measurement callback, reference clock and periods
+* \Parameters (out): system clock in Hz (0 -> no measurement)
+*******************************************************************************/
+static SysCtrl_systemClock SysCtrl_measureClock(const SysCtrl_clockMeasureType *measure_ptr)
+{
+	unsigned long cycles = measure_ptr->measure(measure_ptr->periods);
+
+	return (SysCtrl_systemClock)(((unsigned long long)cycles * measure_ptr->referenceClock) / measure_ptr->periods);
+}
+
+/******************************************************************************
+* \Syntax          : static void SysCtrl_publishMeasuredClock(SysCtrl_systemClock measuredClock)
+* \Description     : Replace The Nominal System Clock (and PIOSC when it feeds the system clock) By
+*                    A Measured One And Notify Drivers So Baud Rates Are Recomputed
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : measuredClock -> measured system clock in Hz
+* \Parameters (out): None
+*******************************************************************************/
+static void SysCtrl_publishMeasuredClock(SysCtrl_systemClock measuredClock)
+{
+	SysCtrl_systemClock oldClock = g_sysCtrlSystemClock;
+	SysCtrl_systemClock nominalClock = (g_sysCtrlConfigurations != (void *)0) ? g_sysCtrlConfigurations->achievedClock : PIOSC;
+
+	SysCtrl_notifyClockChange(SYSCTRL_CLOCK_CHANGE_PRE, oldClock, measuredClock);
+	if (SysCtrl_pioscDerived(g_sysCtrlConfigurations))
+	{
+		g_pioscClock = (SysCtrl_systemClock)(((unsigned long long)PIOSC * measuredClock) / nominalClock);
+	}
+	g_sysCtrlSystemClock = measuredClock;
+	SysCtrl_updateClockCache();
+	SysCtrl_notifyClockChange(SYSCTRL_CLOCK_CHANGE_POST, oldClock, g_sysCtrlSystemClock);
+}
+
+/******************************************************************************
+* \Syntax          : static void SysCtrl_finishPendingClock(void)
+* \Description     : Complete The Switch Started By SysCtrl_startSystemClock And Notify
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+*******************************************************************************/
+static void SysCtrl_finishPendingClock(void)
+{
+	const SysCtrl_configType *config_ptr = g_pendingClockConfig;
+	SysCtrl_clockReadyCallbackType readyCallback = g_clockReadyCallback;
+
+	if (config_ptr == (void *)0)
+	{
+		return; /*Already Finished*/
+	}
+
+	g_pendingClockConfig = (void *)0;
+	g_clockReadyCallback = (void *)0;
+
+	if (PLL_OPERATING_NORMALLY == config_ptr->plluse)
+	{
+		SysCtrl_recordPllLock();
+	}
+
+	SysCtrl_completeClockSwitch(config_ptr);
+
+	SysCtrl_notifyClockChange(SYSCTRL_CLOCK_CHANGE_POST, g_pendingClockOldClock, g_sysCtrlSystemClock);
+
+	if (readyCallback != (void *)0)
+	{
+		readyCallback(g_sysCtrlSystemClock);
+	}
+}
+
+/******************************************************************************
+* \Syntax          : static SysCtrl_returnType SysCtrl_waitPllLock(void)
+* \Description     : Bounded Wait For PLL Lock .. the PLL is power cycled up to
+*                    SYSCTRL_PLL_LOCK_RETRIES times when it misses SYSCTRL_PLL_LOCK_TIMEOUT_CYCLES
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): SYSCTRL_E_OK / SYSCTRL_E_TIMEOUT
+*******************************************************************************/
+static SysCtrl_returnType SysCtrl_waitPllLock(void)
+{
+	for (;;)
+	{
+		if (SysCtrl_getPllStatus() == PLL_IS_LOCKED)
+		{
+			SysCtrl_recordPllLock();
+			return SYSCTRL_E_OK;
+		}
+		if ((SYSCTRL_CYCLE_COUNT() - g_pllAttemptStart) >= SYSCTRL_PLL_LOCK_TIMEOUT_CYCLES)
+		{
+			if (g_pllAttempt >= SYSCTRL_PLL_LOCK_RETRIES)
+			{
+				g_pllStats.failureCount++;
+				SYSCTRL_TRACE_EVENT(SYSCTRL_TRACE_CLOCK_FALLBACK, 0, sysCtrl_FallbackConfig.achievedClock);
+				return SYSCTRL_E_TIMEOUT;
+			}
+			SysCtrl_restartPll();
+		}
+	}
+}
+
+/******************************************************************************
+* \Syntax          : static void SysCtrl_restartPll(void)
+* \Description     : Power Cycle The PLL For Another Lock Attempt
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+*******************************************************************************/
+static void SysCtrl_restartPll(void)
+{
+	g_pllAttempt++;
+	g_pllStats.retryCount++;
+
+	SYSCTRL_REG_MODIFY(SYSCTL_RCC2_R_OFFSET, 0, (1 << PWRDN2));
+	SYSCTRL_REG_MODIFY(SYSCTL_RCC2_R_OFFSET, (1 << PWRDN2), 0);
+	SYSCTRL_TRACE_EVENT(SYSCTRL_TRACE_PLL_POWER_UP, g_pllAttempt, 0);
+
+	g_pllAttemptStart = SYSCTRL_CYCLE_COUNT();
+}
+
+/******************************************************************************
+* \Syntax          : static void SysCtrl_recordPllLock(void)
+* \Description     : Record Lock Latency Since The PLL Was Programmed
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+*******************************************************************************/
+static void SysCtrl_recordPllLock(void)
+{
+	unsigned long lockCycles = SYSCTRL_CYCLE_COUNT() - g_pllLockStart;
+
+	g_pllStats.lastLockCycles = lockCycles;
+	if (lockCycles > g_pllStats.maxLockCycles)
+	{
+		g_pllStats.maxLockCycles = lockCycles;
+	}
+	g_pllStats.lockCount++;
+	SYSCTRL_TRACE_EVENT(SYSCTRL_TRACE_PLL_LOCKED, 0, lockCycles);
+}
+
+/******************************************************************************
+* \Syntax          : static void SysCtrl_notifyClockChange(SysCtrl_clockChangeEventType event,
+*                                       SysCtrl_systemClock oldClock, SysCtrl_systemClock newClock)
+* \Description     : Call All Registered Clock Change Callbacks
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : event -> before / after change
+*                  : oldClock / newClock -> system clock before and after the change
+* \Parameters (out): None
+*******************************************************************************/
+static void SysCtrl_notifyClockChange(SysCtrl_clockChangeEventType event, SysCtrl_systemClock oldClock, SysCtrl_systemClock newClock)
+{
+	unsigned char index;
+
+	for (index = 0; index < SYSCTRL_CLOCK_CHANGE_CALLBACKS; index++)
+	{
+		if (g_clockChangeCallbacks[index] != (void *)0)
+		{
+			g_clockChangeCallbacks[index](event, oldClock, newClock);
+		}
+	}
+}
+#if (SYSCTRL_GATE_ACCESS == SYSCTRL_GATE_ACCESS_BITBAND)
+/******************************************************************************
+* \Syntax          : static void SysCtrl_writeGateBits(unsigned long offset, unsigned long mask, unsigned long value)
+* \Description     : Write Every Gate Bit In mask Through The Bit-Band Alias .. each store is atomic
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : offset -> RCGC register offset / mask -> gate bits / value -> 1 open, 0 close
+* \Parameters (out): None
+*******************************************************************************/
+static void SysCtrl_writeGateBits(unsigned long offset, unsigned long mask, unsigned long value)
+{
+	unsigned char bit;
+
+	for (bit = 0; mask != 0; bit++, mask >>= 1)
+	{
+		if (mask & 1)
+		{
+			SYSCTL_REG_BIT_WRITE(offset, bit, value);
+		}
+	}
+}
+#endif
+
+#if (SYSCTRL_SHADOW_REGISTERS == 1U)
+/******************************************************************************
+* \Syntax          : void SysCtrl_shadowSync(void)
+* \Description     : Reload The RCC, RCC2 And RCGCx Shadow From Hardware .. call after code outside
+*                    the driver wrote one of these registers
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+*******************************************************************************/
+void SysCtrl_shadowSync(void)
+{
+	unsigned char periphral;
+
+	g_shadow.rcc = SYSCTL_REG_READ(SYSCTL_RCC_R_OFFSET);
+	g_shadow.rcc2 = SYSCTL_REG_READ(SYSCTL_RCC2_R_OFFSET);
+	for (periphral = 0; periphral < SYSCTRL_NUM_OF_PERIPHRALS; periphral++)
+	{
+		g_shadow.rcgc[g_RcgPreiphralOfsset[periphral] >> 2] = SYSCTL_REG_READ(SYSCTL_RCGC_OFFSET + g_RcgPreiphralOfsset[periphral]);
+	}
+	g_shadow.valid = 1;
+}
+
+/******************************************************************************
+* \Syntax          : SysCtrl_returnType SysCtrl_shadowCheck(void)
+* \Description     : Debug Consistency Check .. compare every shadowed register with hardware,
+*                    mismatches are counted (SysCtrl_shadowGetMismatches) and traced, the shadow is kept
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): SYSCTRL_E_OK / SYSCTRL_E_NOT_OK (shadow and hardware differ)
+*******************************************************************************/
+SysCtrl_returnType SysCtrl_shadowCheck(void)
+{
+	SysCtrl_returnType status = SYSCTRL_E_OK;
+	unsigned long offset;
+	unsigned long hardware;
+	unsigned char index;
+
+	for (index = 0; index < (SYSCTRL_NUM_OF_PERIPHRALS + 2); index++)
+	{
+		if (index < SYSCTRL_NUM_OF_PERIPHRALS)
+		{
+			offset = SYSCTL_RCGC_OFFSET + g_RcgPreiphralOfsset[index];
+		}
+		else
+		{
+			offset = (index == SYSCTRL_NUM_OF_PERIPHRALS) ? SYSCTL_RCC_R_OFFSET : SYSCTL_RCC2_R_OFFSET;
+		}
+
+		hardware = SYSCTL_REG_READ(offset);
+		if (hardware != *SysCtrl_shadowSlot(offset))
+		{
+			g_shadowMismatches++;
+			SYSCTRL_TRACE_EVENT(SYSCTRL_TRACE_SHADOW_MISMATCH, offset, hardware);
+			status = SYSCTRL_E_NOT_OK;
+		}
+	}
+	return status;
+}
+
+/******************************************************************************
+* \Syntax          : unsigned long SysCtrl_shadowGetMismatches(void)
+* \Description     : Shadow Mismatches Found Since Boot
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): mismatch count
+*******************************************************************************/
+unsigned long SysCtrl_shadowGetMismatches(void)
+{
+	return g_shadowMismatches;
+}
+
+/******************************************************************************
+* \Syntax          : static unsigned long *SysCtrl_shadowSlot(unsigned long offset)
+* \Description     : RAM Copy Of A Shadowed Register
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : offset -> register offset from SYSCTL_BASE
+* \Parameters (out): shadow word / NULL (register is not shadowed)
+*******************************************************************************/
+static unsigned long *SysCtrl_shadowSlot(unsigned long offset)
+{
+	unsigned long *shadow_ptr = (void *)0;
+
+	if (g_shadow.valid == 0)
+	{
+		SysCtrl_shadowSync();
+	}
+
+	if (offset == SYSCTL_RCC_R_OFFSET)
+	{
+		shadow_ptr = &g_shadow.rcc;
+	}
+	else if (offset == SYSCTL_RCC2_R_OFFSET)
+	{
+		shadow_ptr = &g_shadow.rcc2;
+	}
+	else if ((offset >= SYSCTL_RCGC_OFFSET) && (offset < (SYSCTL_RCGC_OFFSET + (SYSCTRL_SHADOW_RCGC_WORDS * 4))))
+	{
+		shadow_ptr = &g_shadow.rcgc[(offset - SYSCTL_RCGC_OFFSET) >> 2];
+	}
+	return shadow_ptr;
+}
+
+/******************************************************************************
+* \Syntax          : static void SysCtrl_shadowModify(unsigned long offset, unsigned long clearMask,
+*                                                     unsigned long setMask, unsigned char commit)
+* \Description     : Update A Register Image In RAM And Optionally Write It .. no bus read.
+*                    Registers that are not shadowed are accessed directly.
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : offset -> register offset from SYSCTL_BASE
+*                  : clearMask -> bits to clear (~0 -> write) / setMask -> bits to set
+*                  : commit -> 1 write the image to hardware, 0 keep it in RAM
+* \Parameters (out): None
+*******************************************************************************/
+static void SysCtrl_shadowModify(unsigned long offset, unsigned long clearMask, unsigned long setMask, unsigned char commit)
+{
+	unsigned long *shadow_ptr = SysCtrl_shadowSlot(offset);
+
+	if (shadow_ptr == (void *)0)
+	{
+		if (clearMask == ~0UL)
+		{
+			SYSCTL_REG_WRITE(offset, setMask);
+		}
+		else
+		{
+			SYSCTL_REG_MODIFY(offset, clearMask, setMask);
+		}
+	}
+	else
+	{
+		*shadow_ptr = (*shadow_ptr & ~clearMask) | setMask;
+		if (commit)
+		{
+			SYSCTL_REG_WRITE(offset, *shadow_ptr);
+#if (SYSCTRL_SHADOW_CHECK == 1U)
+			if (SYSCTL_REG_READ(offset) != *shadow_ptr)
+			{
+				g_shadowMismatches++;
+				SYSCTRL_TRACE_EVENT(SYSCTRL_TRACE_SHADOW_MISMATCH, offset, SYSCTL_REG_READ(offset));
+			}
+#endif
+		}
+	}
+}
+#endif
+
+#if (SYSCTRL_TRACE == 1U)
+/******************************************************************************
+* \Syntax          : void SysCtrl_traceRecord(unsigned short event, unsigned short param, unsigned long value)
+* \Description     : Append One Trace Record .. the slot is claimed with an atomic increment, so
+*                    thread and interrupt trace points never block each other. Oldest records are overwritten.
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : event -> SYSCTRL_TRACE_xxx / param, value -> event data
+* \Parameters (out): None
+*******************************************************************************/
+void SysCtrl_traceRecord(unsigned short event, unsigned short param, unsigned long value)
+{
+	unsigned long timestamp = SYSCTRL_CYCLE_COUNT();
+	SysCtrl_traceRecordType *record_ptr =
+		&g_trace.record[__atomic_fetch_add(&g_trace.head, 1UL, __ATOMIC_RELAXED) & (SYSCTRL_TRACE_DEPTH - 1)];
+
+	record_ptr->timestamp = timestamp;
+	record_ptr->event = event;
+	record_ptr->param = param;
+	record_ptr->value = value;
+}
+
+/******************************************************************************
+* \Syntax          : const SysCtrl_traceBufferType *SysCtrl_traceGetBuffer(void)
+* \Description     : Trace Buffer To Dump For tools/SysCtrl_traceDecode.c
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): trace buffer
+*******************************************************************************/
+const SysCtrl_traceBufferType *SysCtrl_traceGetBuffer(void)
+{
+	return &g_trace;
+}
+
+/******************************************************************************
+* \Syntax          : void SysCtrl_traceClear(void)
+* \Description     : Drop Every Trace Record
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+*******************************************************************************/
+void SysCtrl_traceClear(void)
+{
+	g_trace.head = 0;
+}
+#endif
+
+/**********************************************************************************************************************
+ *  END OF FILE: FileName.c
+ *********************************************************************************************************************/
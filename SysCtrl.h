@@ -1,181 +1,376 @@
-/******************************************************************************
- *
- * Module: System Control
- *
- * File Name: SysCtrl.h
- *
- * Description:Header File For System Control Module 
- * System control configures the overall operation of the device and provides information about the
- * device. Configurable features include reset control, NMI operation, power control, clock control, and low-power modes.
- *
- * Author: Sayed Mohsen
- *
- *******************************************************************************/
-#ifndef SYSCTR_H
-#define SYSCTR_H
-
-/**********************************************************************************************************************
- * INCLUDES
- *********************************************************************************************************************/
-
-
-/**********************************************************************************************************************
- *  GLOBAL CONSTANT MACROS
- *********************************************************************************************************************/
-
-/* Main OSC Clock Source Predefined Set Value */
-#define SYSCTL_RCC_XTAL_4MHZ    0x00000180  // 4 MHz
-#define SYSCTL_RCC_XTAL_4_09MHZ 0x000001C0  // 4.096 MHz
-#define SYSCTL_RCC_XTAL_4_91MHZ 0x00000200  // 4.9152 MHz
-#define SYSCTL_RCC_XTAL_5MHZ    0x00000240  // 5 MHz
-#define SYSCTL_RCC_XTAL_5_12MHZ 0x00000280  // 5.12 MHz
-#define SYSCTL_RCC_XTAL_6MHZ    0x000002C0  // 6 MHz
-#define SYSCTL_RCC_XTAL_6_14MHZ 0x00000300  // 6.144 MHz
-#define SYSCTL_RCC_XTAL_7_37MHZ 0x00000340  // 7.3728 MHz
-#define SYSCTL_RCC_XTAL_8MHZ    0x00000380  // 8 MHz
-#define SYSCTL_RCC_XTAL_8_19MHZ 0x000003C0  // 8.192 MHz
-#define SYSCTL_RCC_XTAL_10MHZ   0x00000400  // 10 MHz
-#define SYSCTL_RCC_XTAL_12MHZ   0x00000440  // 12 MHz
-#define SYSCTL_RCC_XTAL_12_2MHZ 0x00000480  // 12.288 MHz
-#define SYSCTL_RCC_XTAL_13_5MHZ 0x000004C0  // 13.56 MHz
-#define SYSCTL_RCC_XTAL_14_3MHZ 0x00000500  // 14.31818 MHz
-#define SYSCTL_RCC_XTAL_16MHZ   0x00000540  // 16 MHz
-#define SYSCTL_RCC_XTAL_16_3MHZ 0x00000580  // 16.384 MHz
-#define SYSCTL_RCC_XTAL_18MHZ   0x000005C0  // 18.0 MHz (USB)
-#define SYSCTL_RCC_XTAL_20MHZ   0x00000600  // 20.0 MHz (USB)
-#define SYSCTL_RCC_XTAL_24MHZ   0x00000640  // 24.0 MHz (USB)
-#define SYSCTL_RCC_XTAL_25MHZ   0x00000680  // 25.0 MHz (USB)
-
-
-/*reset cause after reset. */
-#define SYSCTRL_EXTERNAL_RESET            (unsigned long)1
-#define SYSCTRL_POWER_ON_RESET            (unsigned long)2
-#define SYSCTRL_BROWN_OUT_RESET           (unsigned long)4
-#define SYSCTRL_WDT0_RESET                (unsigned long)8
-#define SYSCTRL_SOFTWARE_RESET            (unsigned long)16
-#define SYSCTRL_WDT1_RESET                (unsigned long)32
-#define SYSCTRL_MOSC_FAILURE_RESET        (unsigned long)65536
-
-
-
-/**********************************************************************************************************************
- *  GLOBAL DATA TYPES AND STRUCTURES
- *********************************************************************************************************************/
-
-typedef enum 
-{
-	SYSCTRL_NOT_INITIALIZED,
-	SYSCTRL_INITIALIZED,
-}SysCtrl_statusType;
-
-/*Type Definitions For Reset Causes */
-typedef unsigned long SysCtrl_resetCauseType;
-
-/*Type Definitions For Setting PLL Usage. */
-typedef enum {
-	PLL_OPERATING_NORMALLY,/*Power UP PLL*/
-	PLL_POWERED_DOWM/*Power Down PLL*/
-}SysCtrl_pllUsageType;
-
-/*Type Definitions For Current  PLL Status. */
-typedef enum {
-	PLL_IS_UNLOCKED,/*The PLL is unpowered or is not yet locked.*/
-	PLL_IS_LOCKED,/*The PLL is powered and locked.*/
-} SysCtrl_pllStatusType;
-
-/*Type Definitions For Current  PLL Divisor. */
-typedef enum {
-	PLL_200MHZ ,/*Divide PLL By 2.. Provide small Range Of Freqs*/
-	PLL_400MHZ,/*Divide PLL..Provide wider Range Of Freqs*/
-}SysCtrl_pllFreqType;
-
-
-/*Type Definitions For Selecting the input source for the OSC. */
-typedef enum {
-	CLOCK_SOURCE_MAIN_OSCILLATOR,/*External, Default 16Mhz launchpad*/
-	CLOCK_SOURCE_PRECISION_INTERNAL_OSCILLATOR,/*16MHZ*/
-	CLOCK_SOURCE_PRECISION_INTERNAL_OSCILLATOR_DIVDED_4,/*4MHZ*/
-	CLOCK_SOURCE_LOW_FREQUENCY_INTERNAL_OSCILLATOR,/*30-kHz internal oscillator*/
-	CLOCK_SOURCE_HIBERNTION_OSCILLATOR =7/*32.768-kHz external oscillator*/
-}SysCtrl_ClockSourceType;
-
-/*Type Definition For Main OSC Attached Crystal Clock Source Value*/
-typedef enum 
-{
-	XTAL_4MHZ  ,  
-	XTAL_4_09MHZ ,
-	XTAL_4_91MHZ ,
-	XTAL_5MHZ    ,
-	XTAL_5_12MHZ ,
-	XTAL_6MHZ    ,
-	XTAL_6_14MHZ ,
-	XTAL_7_37MHZ ,
-	XTAL_8MHZ    ,
-	XTAL_8_19MHZ ,
-	XTAL_10MHZ   ,
-	XTAL_12MHZ   ,
-	XTAL_12_2MHZ ,
-	XTAL_13_5MHZ ,
-	XTAL_14_3MHZ ,
-	XTAL_16MHZ  ,
-	XTAL_16_3MHZ,
-	XTAL_18MHZ  ,
-	XTAL_20MHZ  ,
-	XTAL_24MHZ ,
-	XTAL_25MHZ,
-}SysCtrl_ExternalCrystalValueType;
-
-/*Type Defintion For System Periphrals*/
-typedef enum {
-	SYSCTL_WD,         
- SYSCTL_TIMER,    
- SYSCTL_GPIO,      
- SYSCTL_CDMA,        
- SYSCTL_CHIB,       
- SYSCTL_CUART,  
- SYSCTL_CSSI,        
- SYSCTL_CI2C,        
- SYSCTL_CUSB,        
- SYSCTL_CCAN,        
- SYSCTL_CADC,        
-SYSCTL_CACMP,       
- SYSCTL_CPWM,        
- SYSCTL_CQEI,        
- SYSCTL_CEEPROM,     
-SYSCTL_CWTIMER,     
-}SysCtrl_systemPeriphralType;
-
-/*instance For For each Periphral ..Ex =Uart0*/
-typedef unsigned char  SysCtrl_periphralInstanceType ; 
-
-typedef unsigned long SysCtrl_systemDivType ;
-typedef unsigned long SysCtrl_systemClock ;
-
-/*Sytyem Contrl Configurations*/
-typedef struct {
-	SysCtrl_ClockSourceType clocksource; 
-	SysCtrl_ExternalCrystalValueType xtal;
-	SysCtrl_pllUsageType plluse ;
-	SysCtrl_pllFreqType pll;
-	SysCtrl_systemClock desiredClock ; 
-}SysCtrl_configType;
-
-/**********************************************************************************************************************
- *  GLOBAL DATA PROTOTYPES
- *********************************************************************************************************************/
-extern SysCtrl_configType sysCtrl_Config ;
- 
-/**********************************************************************************************************************
- *  GLOBAL FUNCTION PROTOTYPES
- *********************************************************************************************************************/
-void SysCtrl_initClock(const SysCtrl_configType *config_ptr);
-void SysCtrl_peripheralEnable(SysCtrl_systemPeriphralType periphral ,SysCtrl_periphralInstanceType instance) ; 
-SysCtrl_resetCauseType SysCtrl_getResetCause (void) ; 
-void SysCtrl_initSystemClock(const SysCtrl_configType *config_ptr) ; 
-void SysCtrl_initPLL(SysCtrl_pllFreqType pllFreq, SysCtrl_systemClock requiredBusClock) ; 
-void SysCtrl_peripheralDisable(SysCtrl_systemPeriphralType periphral ,SysCtrl_periphralInstanceType instance);
-#endif  /* SYSCTR_H */
-
-/**********************************************************************************************************************
- *  END OF FILE: SYSCTR_H.h
- *********************************************************************************************************************/
+/******************************************************************************
+ *
+ * Module: System Control
+ *
+ * File Name: SysCtrl.h
+ *
+ * Description:Header File For System Control Module 
+ * System control configures the overall operation of the device and provides information about the
+ * device. Configurable features include reset control, NMI operation, power control, clock control, and low-power modes.
+ *
+ * Author: Sayed Mohsen
+ *
+ *******************************************************************************/
+#ifndef SYSCTR_H
+#define SYSCTR_H
+
+/**********************************************************************************************************************
+ * INCLUDES
+ *********************************************************************************************************************/
+#include "SysCtrl_Cfg.h"
+
+
+/**********************************************************************************************************************
+ *  GLOBAL CONSTANT MACROS
+ *********************************************************************************************************************/
+
+/* Main OSC Clock Source Predefined Set Value */
+#define SYSCTL_RCC_XTAL_4MHZ    0x00000180  // 4 MHz
+#define SYSCTL_RCC_XTAL_4_09MHZ 0x000001C0  // 4.096 MHz
+#define SYSCTL_RCC_XTAL_4_91MHZ 0x00000200  // 4.9152 MHz
+#define SYSCTL_RCC_XTAL_5MHZ    0x00000240  // 5 MHz
+#define SYSCTL_RCC_XTAL_5_12MHZ 0x00000280  // 5.12 MHz
+#define SYSCTL_RCC_XTAL_6MHZ    0x000002C0  // 6 MHz
+#define SYSCTL_RCC_XTAL_6_14MHZ 0x00000300  // 6.144 MHz
+#define SYSCTL_RCC_XTAL_7_37MHZ 0x00000340  // 7.3728 MHz
+#define SYSCTL_RCC_XTAL_8MHZ    0x00000380  // 8 MHz
+#define SYSCTL_RCC_XTAL_8_19MHZ 0x000003C0  // 8.192 MHz
+#define SYSCTL_RCC_XTAL_10MHZ   0x00000400  // 10 MHz
+#define SYSCTL_RCC_XTAL_12MHZ   0x00000440  // 12 MHz
+#define SYSCTL_RCC_XTAL_12_2MHZ 0x00000480  // 12.288 MHz
+#define SYSCTL_RCC_XTAL_13_5MHZ 0x000004C0  // 13.56 MHz
+#define SYSCTL_RCC_XTAL_14_3MHZ 0x00000500  // 14.31818 MHz
+#define SYSCTL_RCC_XTAL_16MHZ   0x00000540  // 16 MHz
+#define SYSCTL_RCC_XTAL_16_3MHZ 0x00000580  // 16.384 MHz
+#define SYSCTL_RCC_XTAL_18MHZ   0x000005C0  // 18.0 MHz (USB)
+#define SYSCTL_RCC_XTAL_20MHZ   0x00000600  // 20.0 MHz (USB)
+#define SYSCTL_RCC_XTAL_24MHZ   0x00000640  // 24.0 MHz (USB)
+#define SYSCTL_RCC_XTAL_25MHZ   0x00000680  // 25.0 MHz (USB)
+
+
+/*reset cause after reset. */
+#define SYSCTRL_EXTERNAL_RESET            (unsigned long)1
+#define SYSCTRL_POWER_ON_RESET            (unsigned long)2
+#define SYSCTRL_BROWN_OUT_RESET           (unsigned long)4
+#define SYSCTRL_WDT0_RESET                (unsigned long)8
+#define SYSCTRL_SOFTWARE_RESET            (unsigned long)16
+#define SYSCTRL_WDT1_RESET                (unsigned long)32
+#define SYSCTRL_MOSC_FAILURE_RESET        (unsigned long)65536
+
+
+
+/**********************************************************************************************************************
+ *  GLOBAL DATA TYPES AND STRUCTURES
+ *********************************************************************************************************************/
+
+typedef enum 
+{
+	SYSCTRL_NOT_INITIALIZED,
+	SYSCTRL_INITIALIZED,
+}SysCtrl_statusType;
+
+/*Type Definitions For API Return Status*/
+typedef enum
+{
+	SYSCTRL_E_OK,
+	SYSCTRL_E_NOT_OK,
+	SYSCTRL_E_TIMEOUT,
+	SYSCTRL_E_PENDING,
+}SysCtrl_returnType;
+
+/*Type Definitions For Reset Causes */
+typedef unsigned long SysCtrl_resetCauseType;
+
+/*Type Definitions For Setting PLL Usage. */
+typedef enum {
+	PLL_OPERATING_NORMALLY,/*Power UP PLL*/
+	PLL_POWERED_DOWM/*Power Down PLL*/
+}SysCtrl_pllUsageType;
+
+/*Type Definitions For Current  PLL Status. */
+typedef enum {
+	PLL_IS_UNLOCKED,/*The PLL is unpowered or is not yet locked.*/
+	PLL_IS_LOCKED,/*The PLL is powered and locked.*/
+} SysCtrl_pllStatusType;
+
+/*Type Definitions For Current  PLL Divisor. */
+typedef enum {
+	PLL_200MHZ ,/*Divide PLL By 2.. Provide small Range Of Freqs*/
+	PLL_400MHZ,/*Divide PLL..Provide wider Range Of Freqs*/
+}SysCtrl_pllFreqType;
+
+
+/*Type Definitions For Selecting the input source for the OSC. */
+typedef enum {
+	CLOCK_SOURCE_MAIN_OSCILLATOR,/*External, Default 16Mhz launchpad*/
+	CLOCK_SOURCE_PRECISION_INTERNAL_OSCILLATOR,/*16MHZ*/
+	CLOCK_SOURCE_PRECISION_INTERNAL_OSCILLATOR_DIVDED_4,/*4MHZ*/
+	CLOCK_SOURCE_LOW_FREQUENCY_INTERNAL_OSCILLATOR,/*30-kHz internal oscillator*/
+	CLOCK_SOURCE_HIBERNTION_OSCILLATOR =7/*32.768-kHz external oscillator*/
+}SysCtrl_ClockSourceType;
+
+/*Type Definition For Main OSC Attached Crystal Clock Source Value*/
+typedef enum 
+{
+	XTAL_4MHZ  ,  
+	XTAL_4_09MHZ ,
+	XTAL_4_91MHZ ,
+	XTAL_5MHZ    ,
+	XTAL_5_12MHZ ,
+	XTAL_6MHZ    ,
+	XTAL_6_14MHZ ,
+	XTAL_7_37MHZ ,
+	XTAL_8MHZ    ,
+	XTAL_8_19MHZ ,
+	XTAL_10MHZ   ,
+	XTAL_12MHZ   ,
+	XTAL_12_2MHZ ,
+	XTAL_13_5MHZ ,
+	XTAL_14_3MHZ ,
+	XTAL_16MHZ  ,
+	XTAL_16_3MHZ,
+	XTAL_18MHZ  ,
+	XTAL_20MHZ  ,
+	XTAL_24MHZ ,
+	XTAL_25MHZ,
+}SysCtrl_ExternalCrystalValueType;
+
+/*Type Defintion For System Periphrals*/
+typedef enum {
+	SYSCTL_WD,         
+ SYSCTL_TIMER,    
+ SYSCTL_GPIO,      
+ SYSCTL_CDMA,        
+ SYSCTL_CHIB,       
+ SYSCTL_CUART,  
+ SYSCTL_CSSI,        
+ SYSCTL_CI2C,        
+ SYSCTL_CUSB,        
+ SYSCTL_CCAN,        
+ SYSCTL_CADC,        
+SYSCTL_CACMP,       
+ SYSCTL_CPWM,        
+ SYSCTL_CQEI,        
+ SYSCTL_CEEPROM,     
+SYSCTL_CWTIMER,     
+}SysCtrl_systemPeriphralType;
+
+/*instance For For each Periphral ..Ex =Uart0*/
+typedef unsigned char  SysCtrl_periphralInstanceType ; 
+
+/*Number Of Gated Periphrals In SysCtrl_systemPeriphralType*/
+#define SYSCTRL_NUM_OF_PERIPHRALS (16U)
+
+/*Clock Source Of A UART/SSI/Timer Instance (UARTCC/SSICC/GPTMCC)*/
+typedef enum {
+	SYSCTRL_PERIPHRAL_CLOCK_SYSTEM,/*System Clock*/
+	SYSCTRL_PERIPHRAL_CLOCK_ALTERNATE/*Alternate Clock (ALTCLKCFG)*/
+}SysCtrl_periphralClockSourceType;
+
+/*Alternate Clock Source (ALTCLKCFG ALTCLK field)*/
+typedef enum {
+	SYSCTRL_ALT_CLOCK_PIOSC = 0,/*16MHZ Internal Oscillator*/
+	SYSCTRL_ALT_CLOCK_RTCOSC = 3,/*32.768-kHz Hibernation Oscillator .. hibernation module clock enabled*/
+	SYSCTRL_ALT_CLOCK_LFIOSC = 4/*30-kHz Internal Oscillator*/
+}SysCtrl_altClockSourceType;
+
+/*Set Of Periphral Instances .. one bit per instance, one mask per periphral*/
+typedef struct {
+	unsigned long instanceMask[SYSCTRL_NUM_OF_PERIPHRALS];
+}SysCtrl_periphralSetType;
+
+/*Periphral Recovery Sequence*/
+typedef enum {
+	SYSCTRL_RECOVER_RESET,/*SRxxx Assert And Release, Clock Gates Untouched*/
+	SYSCTRL_RECOVER_POWER_CYCLE/*Open Run Mode Gates Closed While In Reset, Reopened Before Release*/
+}SysCtrl_recoverActionType;
+
+/*Core Cycles Spent In Each Recovery Step*/
+typedef struct {
+	unsigned long assertCycles;/*Reset (And Gate) Writes*/
+	unsigned long holdCycles;/*Reset Held Asserted*/
+	unsigned long releaseCycles;/*Release (And Gate) Writes*/
+	unsigned long readyCycles;/*Release Until Every Instance Reports Ready In PRxxx*/
+}SysCtrl_recoverTimingType;
+
+/*Driver Identifier Holding A Periphral Clock Gate (0 .. 31)*/
+typedef unsigned char SysCtrl_gateOwnerType;
+
+#define SYSCTRL_PERIPHRAL_SET_ADD(set, periphral, instance) ((set).instanceMask[(periphral)] |= (1UL << (instance)))
+
+typedef unsigned long SysCtrl_systemDivType ;
+typedef unsigned long SysCtrl_systemClock ;
+
+/*Sytyem Contrl Configurations*/
+typedef struct {
+	SysCtrl_ClockSourceType clocksource; 
+	SysCtrl_ExternalCrystalValueType xtal;
+	SysCtrl_pllUsageType plluse ;
+	SysCtrl_pllFreqType pll;
+	SysCtrl_systemClock desiredClock ; 
+	/*Resolved At Build Time By SYSCTRL_CLOCK_CONFIG (SysCtrl_clockTree.h)*/
+	unsigned long rccImage ;
+	unsigned long rcc2Image ;
+	SysCtrl_systemClock achievedClock ;
+}SysCtrl_configType;
+
+/*PLL Lock Statistics*/
+typedef struct {
+	unsigned long lastLockCycles;/*Core Cycles From PLL Programming To Lock*/
+	unsigned long maxLockCycles;
+	unsigned long lockCount;
+	unsigned long retryCount;
+	unsigned long failureCount;/*Lock Attempts That Ended On The Fallback Clock*/
+}SysCtrl_pllStatsType;
+
+/*Type Definitions For Frequency Planner Goal*/
+typedef enum {
+	SYSCTRL_PLAN_CLOSEST,/*Closest Achievable Clock To targetClock Within tolerancePermille*/
+	SYSCTRL_PLAN_MAX_UNDER_CAP/*Highest Achievable Clock Not Above targetClock (Power Cap)*/
+}SysCtrl_planGoalType;
+
+/*Allowed Sources Mask Bit For SysCtrl_planRequestType*/
+#define SYSCTRL_PLAN_SOURCE(clocksource) (1U << (clocksource))
+
+/*Frequency Planner Request*/
+typedef struct {
+	SysCtrl_planGoalType goal;
+	SysCtrl_systemClock targetClock;
+	unsigned long tolerancePermille;
+	SysCtrl_ExternalCrystalValueType xtal;/*Crystal Attached To The Board*/
+	unsigned char allowedSources;/*SYSCTRL_PLAN_SOURCE(...) bits*/
+}SysCtrl_planRequestType;
+
+/*Clock Profile Index In sysCtrl_Profiles*/
+typedef unsigned char SysCtrl_profileIdType;
+
+/*Named Clock Profile .. register images and gate masks are resolved at build time*/
+typedef struct {
+	const char *name;
+	SysCtrl_configType clock;/*SYSCTRL_CLOCK_CONFIG(...)*/
+	SysCtrl_periphralSetType gatesOn;/*Run Mode Gates Opened On Switch*/
+	SysCtrl_periphralSetType gatesOff;/*Run Mode Gates Closed On Switch .. acquired instances stay open*/
+}SysCtrl_profileType;
+
+/*Type Definitions For Clock Change Notification*/
+typedef enum {
+	SYSCTRL_CLOCK_CHANGE_PRE,/*System Clock Is About To Change*/
+	SYSCTRL_CLOCK_CHANGE_POST/*System Clock Has Changed*/
+}SysCtrl_clockChangeEventType;
+
+/*Main Oscillator Failure Record*/
+typedef struct {
+	unsigned long failureCount;
+	unsigned long lastFailureCycles;/*Cycle Counter When The Last Failure Was Handled*/
+	unsigned char failedOver;/*1 -> Running On sysCtrl_MoscFailoverConfig, MOSC Configurations Refused*/
+}SysCtrl_moscStatusType;
+
+/*Type Definitions For Low Power Modes Entered On WFI*/
+typedef enum {
+	SYSCTRL_POWER_MODE_SLEEP,/*Core Clock Stopped, SCGCx Gates Apply*/
+	SYSCTRL_POWER_MODE_DEEP_SLEEP/*Clock Tree On sysCtrl_DeepSleepConfig, DCGCx Gates Apply*/
+}SysCtrl_powerModeType;
+
+/*Deep-Sleep Clock (DSLPCLKCFG)*/
+typedef struct {
+	SysCtrl_ClockSourceType clocksource;/*MOSC, PIOSC, LFIOSC Or 32.768-kHz .. PIOSC/4 Not Allowed*/
+	unsigned char divisor;/*1 .. 64*/
+}SysCtrl_deepSleepConfigType;
+
+/*Low Power Statistics*/
+typedef struct {
+	unsigned long sleepCount;
+	unsigned long deepSleepCount;
+	unsigned long lastWakeCycles;/*Core Cycles From Wake Until The Run Clock Is Back .. counted from SysCtrl_markWake
+	                               when the wake handler calls it, else from WFI return (handler time not included)*/
+	unsigned long maxWakeCycles;
+}SysCtrl_powerStatsType;
+
+typedef void (*SysCtrl_clockChangeCallbackType)(SysCtrl_clockChangeEventType event, SysCtrl_systemClock oldClock, SysCtrl_systemClock newClock);
+
+/*Called When A Clock Switch Started By SysCtrl_startSystemClock Is Finished*/
+typedef void (*SysCtrl_clockReadyCallbackType)(SysCtrl_systemClock newClock);
+
+/*System Clock Cycles Counted Over A Number Of Reference Periods (0 -> no measurement) .. e.g. a timer
+  in edge-time capture mode fed by the 32.768-kHz hibernation clock or a MOSC derived signal*/
+typedef unsigned long (*SysCtrl_clockMeasureCallbackType)(unsigned long periods);
+
+/*Clock Measurement Against A Reference*/
+typedef struct {
+	SysCtrl_clockMeasureCallbackType measure;
+	SysCtrl_systemClock referenceClock;/*Reference Frequency In Hz*/
+	unsigned long periods;/*Reference Periods Per Measurement*/
+}SysCtrl_clockMeasureType;
+
+/**********************************************************************************************************************
+ *  GLOBAL DATA PROTOTYPES
+ *********************************************************************************************************************/
+extern SysCtrl_configType sysCtrl_Config ;
+extern const SysCtrl_profileType sysCtrl_Profiles[SYSCTRL_NUM_OF_PROFILES];
+extern const SysCtrl_configType sysCtrl_FallbackConfig;
+extern const SysCtrl_configType sysCtrl_MoscFailoverConfig;
+extern const SysCtrl_deepSleepConfigType sysCtrl_DeepSleepConfig;
+ 
+/**********************************************************************************************************************
+ *  GLOBAL FUNCTION PROTOTYPES
+ *********************************************************************************************************************/
+void SysCtrl_initClock(const SysCtrl_configType *config_ptr);
+void SysCtrl_peripheralEnable(SysCtrl_systemPeriphralType periphral ,SysCtrl_periphralInstanceType instance) ; 
+SysCtrl_resetCauseType SysCtrl_getResetCause (void) ; 
+SysCtrl_returnType SysCtrl_initSystemClock(const SysCtrl_configType *config_ptr) ; 
+SysCtrl_returnType SysCtrl_initPLL(SysCtrl_pllFreqType pllFreq, SysCtrl_systemClock requiredBusClock) ; 
+void SysCtrl_peripheralDisable(SysCtrl_systemPeriphralType periphral ,SysCtrl_periphralInstanceType instance);
+SysCtrl_returnType SysCtrl_peripheralEnableSet(const SysCtrl_periphralSetType *set_ptr);
+void SysCtrl_peripheralDisableSet(const SysCtrl_periphralSetType *set_ptr);
+SysCtrl_returnType SysCtrl_peripheralRecoverSet(const SysCtrl_periphralSetType *set_ptr, SysCtrl_recoverActionType action, SysCtrl_recoverTimingType *timing_ptr);
+SysCtrl_returnType SysCtrl_peripheralAcquire(SysCtrl_systemPeriphralType periphral, SysCtrl_periphralInstanceType instance, SysCtrl_gateOwnerType owner);
+SysCtrl_returnType SysCtrl_peripheralRelease(SysCtrl_systemPeriphralType periphral, SysCtrl_periphralInstanceType instance, SysCtrl_gateOwnerType owner);
+unsigned char SysCtrl_getPeripheralUsers(SysCtrl_systemPeriphralType periphral, SysCtrl_periphralInstanceType instance);
+#if (SYSCTRL_GATE_OWNER_TRACKING == 1U)
+unsigned long SysCtrl_getPeripheralOwners(SysCtrl_systemPeriphralType periphral, SysCtrl_periphralInstanceType instance);
+#endif
+#if (SYSCTRL_SHADOW_REGISTERS == 1U)
+void SysCtrl_shadowSync(void);
+SysCtrl_returnType SysCtrl_shadowCheck(void);
+unsigned long SysCtrl_shadowGetMismatches(void);
+#endif
+SysCtrl_pllStatusType SysCtrl_getPllStatus( void ) ;
+SysCtrl_returnType SysCtrl_setSystemClock(const SysCtrl_configType *config_ptr);
+SysCtrl_returnType SysCtrl_switchProfile(SysCtrl_profileIdType profileId);
+SysCtrl_profileIdType SysCtrl_getProfile(void);
+SysCtrl_returnType SysCtrl_startSystemClock(const SysCtrl_configType *config_ptr, SysCtrl_clockReadyCallbackType readyCallback);
+SysCtrl_returnType SysCtrl_pollSystemClock(void);
+void SysCtrl_pllLockHandler(void);
+void SysCtrl_getPllStats(SysCtrl_pllStatsType *stats_ptr);
+SysCtrl_systemClock SysCtrl_getSystemClock(void);
+SysCtrl_systemClock SysCtrl_getUsbClock(void);
+SysCtrl_systemClock SysCtrl_getPeripheralClock(SysCtrl_systemPeriphralType periphral, SysCtrl_periphralInstanceType instance);
+SysCtrl_returnType SysCtrl_setPeripheralClockSource(SysCtrl_systemPeriphralType periphral, SysCtrl_periphralInstanceType instance, SysCtrl_periphralClockSourceType source);
+SysCtrl_returnType SysCtrl_setAltClockSource(SysCtrl_altClockSourceType source);
+SysCtrl_systemClock SysCtrl_getAltClock(void);
+void SysCtrl_getAltClockInstances(SysCtrl_periphralSetType *set_ptr);
+SysCtrl_returnType SysCtrl_setPwmClockDivider(unsigned char divider);
+SysCtrl_returnType SysCtrl_measureSystemClock(const SysCtrl_clockMeasureType *measure_ptr, SysCtrl_systemClock *clock_ptr);
+SysCtrl_returnType SysCtrl_calibratePiosc(const SysCtrl_clockMeasureType *measure_ptr);
+SysCtrl_systemClock SysCtrl_getCrystalClock(SysCtrl_ExternalCrystalValueType attachedCrystal);
+SysCtrl_systemClock SysCtrl_getOscillatorClock(SysCtrl_ClockSourceType clocksource, SysCtrl_ExternalCrystalValueType xtal);
+SysCtrl_returnType SysCtrl_planSystemClock(const SysCtrl_planRequestType *request_ptr, SysCtrl_configType *config_ptr);
+SysCtrl_returnType SysCtrl_registerClockChangeCallback(SysCtrl_clockChangeCallbackType callback);
+void SysCtrl_unregisterClockChangeCallback(SysCtrl_clockChangeCallbackType callback);
+void SysCtrl_lowPowerGateEnable(SysCtrl_powerModeType mode, SysCtrl_systemPeriphralType periphral, SysCtrl_periphralInstanceType instance);
+void SysCtrl_lowPowerGateDisable(SysCtrl_powerModeType mode, SysCtrl_systemPeriphralType periphral, SysCtrl_periphralInstanceType instance);
+void SysCtrl_setLowPowerGates(SysCtrl_powerModeType mode, const SysCtrl_periphralSetType *set_ptr);
+SysCtrl_returnType SysCtrl_setDeepSleepClock(const SysCtrl_deepSleepConfigType *config_ptr);
+SysCtrl_systemClock SysCtrl_getDeepSleepClock(void);
+void SysCtrl_enterSleep(void);
+SysCtrl_returnType SysCtrl_enterDeepSleep(void);
+void SysCtrl_markWake(void);
+void SysCtrl_getPowerStats(SysCtrl_powerStatsType *stats_ptr);
+void SysCtrl_moscFailHandler(void);
+void SysCtrl_getMoscStatus(SysCtrl_moscStatusType *status_ptr);
+void SysCtrl_clearMoscFailure(void);
+#endif  /* SYSCTR_H */
+
+/**********************************************************************************************************************
+ *  END OF FILE: SYSCTR_H.h
+ *********************************************************************************************************************/
@@ -0,0 +1,219 @@
+/******************************************************************************
+ *
+ * Module: System Control
+ *
+ * File Name: SysCtrl.hpp
+ *
+ * Description: Header Only C++ Front End For Run Mode Clock Gates
+ * Periphral and instance are template arguments, so the RCGC address and the gate bit are
+ * constants and the instance range is checked at build time. A gate toggle is one bit-band
+ * store (SYSCTRL_GATE_ACCESS_BITBAND) or one read-modify-write of a constant address.
+ * With SYSCTRL_SHADOW_REGISTERS or SYSCTRL_TRACE the C functions are called instead, so
+ * the shadow and the trace stay complete. The C API is used unchanged. disable() does not know
+ * about gates taken with SysCtrl_peripheralAcquire, shared gates go through Acquire / Release.
+ *
+ *   SysCtrl::Gate<SYSCTL_CUART, 1>::enable();
+ *   SysCtrl::GateSet<SysCtrl::Gate<SYSCTL_GPIO, 0>, SysCtrl::Gate<SYSCTL_GPIO, 5> >::enable();
+ *
+ * Author: Sayed Mohsen
+ *
+ *******************************************************************************/
+#ifndef SYSCTRL_HPP
+#define SYSCTRL_HPP
+
+/**********************************************************************************************************************
+ * INCLUDES
+ *********************************************************************************************************************/
+extern "C" {
+#include "SysCtrl.h"
+#include "SysCtrl_map.h"
+#include "SysCtrl_trace.h"
+}
+
+namespace SysCtrl {
+
+/**********************************************************************************************************************
+ *  GLOBAL CONSTANT FUNCTIONS
+ *********************************************************************************************************************/
+
+/*RCGC Sub-Offset Of A Periphral (same order as SysCtrl_systemPeriphralType)*/
+constexpr unsigned long rcgcOffset(SysCtrl_systemPeriphralType periphral)
+{
+	return (periphral == SYSCTL_WD)      ? SYSCTL_RCGCWD_R_OFFSET :
+	       (periphral == SYSCTL_TIMER)   ? SYSCTL_RCGCTIMER_R_OFFSET :
+	       (periphral == SYSCTL_GPIO)    ? SYSCTL_RCGCGPIO_R_OFFSET :
+	       (periphral == SYSCTL_CDMA)    ? SYSCTL_RCGCDMA_R_OFFSET :
+	       (periphral == SYSCTL_CHIB)    ? SYSCTL_RCGCHIB_R_OFFSET :
+	       (periphral == SYSCTL_CUART)   ? SYSCTL_RCGCUART_R_OFFSET :
+	       (periphral == SYSCTL_CSSI)    ? SYSCTL_RCGCSSI_R_OFFSET :
+	       (periphral == SYSCTL_CI2C)    ? SYSCTL_RCGCI2C_R_OFFSET :
+	       (periphral == SYSCTL_CUSB)    ? SYSCTL_RCGCUSB_R_OFFSET :
+	       (periphral == SYSCTL_CCAN)    ? SYSCTL_RCGCCAN_R_OFFSET :
+	       (periphral == SYSCTL_CADC)    ? SYSCTL_RCGCADC_R_OFFSET :
+	       (periphral == SYSCTL_CACMP)   ? SYSCTL_RCGCACMP_R_OFFSET :
+	       (periphral == SYSCTL_CPWM)    ? SYSCTL_RCGCPWM_R_OFFSET :
+	       (periphral == SYSCTL_CQEI)    ? SYSCTL_RCGCQEI_R_OFFSET :
+	       (periphral == SYSCTL_CEEPROM) ? SYSCTL_RCGCEEPROM_R_OFFSET :
+	                                       SYSCTL_RCGCWTIMER_R_OFFSET;
+}
+
+/*Instances Of A Periphral On The TM4C123GH6PM*/
+constexpr unsigned char instanceCount(SysCtrl_systemPeriphralType periphral)
+{
+	return (periphral == SYSCTL_WD)      ? 2 :
+	       (periphral == SYSCTL_TIMER)   ? 6 :
+	       (periphral == SYSCTL_GPIO)    ? 6 :
+	       (periphral == SYSCTL_CUART)   ? 8 :
+	       (periphral == SYSCTL_CSSI)    ? 4 :
+	       (periphral == SYSCTL_CI2C)    ? 4 :
+	       (periphral == SYSCTL_CCAN)    ? 2 :
+	       (periphral == SYSCTL_CADC)    ? 2 :
+	       (periphral == SYSCTL_CPWM)    ? 2 :
+	       (periphral == SYSCTL_CQEI)    ? 2 :
+	       (periphral == SYSCTL_CWTIMER) ? 6 :
+	                                       1; /*DMA, HIB, USB, ACMP, EEPROM*/
+}
+
+/**********************************************************************************************************************
+ *  GLOBAL DATA TYPES AND STRUCTURES
+ *********************************************************************************************************************/
+
+/*Run Mode Clock Gate Of One Periphral Instance*/
+template <SysCtrl_systemPeriphralType Periphral, SysCtrl_periphralInstanceType Instance>
+struct Gate
+{
+	static_assert(Periphral < SYSCTRL_NUM_OF_PERIPHRALS, "unknown periphral");
+	static_assert(Instance < instanceCount(Periphral), "periphral instance not present on the TM4C123");
+
+	static constexpr SysCtrl_systemPeriphralType periphral = Periphral;
+	static constexpr unsigned long offset = SYSCTL_RCGC_OFFSET + rcgcOffset(Periphral);
+	static constexpr unsigned long mask = 1UL << Instance;
+
+	static inline void enable()
+	{
+#if (SYSCTRL_SHADOW_REGISTERS == 1U) || (SYSCTRL_TRACE == 1U)
+		SysCtrl_peripheralEnable(Periphral, Instance);
+#elif (SYSCTRL_GATE_ACCESS == SYSCTRL_GATE_ACCESS_BITBAND)
+		SYSCTL_REG_BIT_WRITE(offset, Instance, 1);
+#else
+		SYSCTL_REG_MODIFY(offset, 0, mask);
+#endif
+	}
+
+	static inline void disable()
+	{
+#if (SYSCTRL_SHADOW_REGISTERS == 1U) || (SYSCTRL_TRACE == 1U)
+		SysCtrl_peripheralDisable(Periphral, Instance);
+#elif (SYSCTRL_GATE_ACCESS == SYSCTRL_GATE_ACCESS_BITBAND)
+		SYSCTL_REG_BIT_WRITE(offset, Instance, 0);
+#else
+		SYSCTL_REG_MODIFY(offset, mask, 0);
+#endif
+	}
+};
+
+/*Group Of Gates .. instance masks are composed at build time, one access per RCGC register touched*/
+template <class... Gates>
+struct GateSet
+{
+	/*Instance Mask Of A Periphral In This Group*/
+	static constexpr unsigned long maskOf(SysCtrl_systemPeriphralType periphral)
+	{
+		return maskOf<Gates...>(periphral);
+	}
+
+	/*Same Group As A C Set For SysCtrl_peripheralEnableSet / sysCtrl_Profiles*/
+	static constexpr SysCtrl_periphralSetType set()
+	{
+		return SysCtrl_periphralSetType{{
+			maskOf(SYSCTL_WD), maskOf(SYSCTL_TIMER), maskOf(SYSCTL_GPIO), maskOf(SYSCTL_CDMA),
+			maskOf(SYSCTL_CHIB), maskOf(SYSCTL_CUART), maskOf(SYSCTL_CSSI), maskOf(SYSCTL_CI2C),
+			maskOf(SYSCTL_CUSB), maskOf(SYSCTL_CCAN), maskOf(SYSCTL_CADC), maskOf(SYSCTL_CACMP),
+			maskOf(SYSCTL_CPWM), maskOf(SYSCTL_CQEI), maskOf(SYSCTL_CEEPROM), maskOf(SYSCTL_CWTIMER)}};
+	}
+
+	static inline void enable()
+	{
+		Walk<SYSCTL_WD>::write(1);
+	}
+
+	static inline void disable()
+	{
+		Walk<SYSCTL_WD>::write(0);
+	}
+
+private:
+	template <class First, class... Rest>
+	static constexpr unsigned long maskOf(SysCtrl_systemPeriphralType periphral)
+	{
+		return ((First::periphral == periphral) ? First::mask : 0UL) | maskOf<Rest...>(periphral);
+	}
+
+	template <int Empty = 0>
+	static constexpr unsigned long maskOf(SysCtrl_systemPeriphralType)
+	{
+		return 0UL;
+	}
+
+	/*Walk The Periphrals At Build Time, Skipping Registers With No Gate In The Group*/
+	template <unsigned int Periphral, bool End = (Periphral >= SYSCTRL_NUM_OF_PERIPHRALS)>
+	struct Walk
+	{
+		static inline void write(unsigned char open)
+		{
+			constexpr SysCtrl_systemPeriphralType periphral = static_cast<SysCtrl_systemPeriphralType>(Periphral);
+			constexpr unsigned long mask = maskOf(periphral);
+
+			if (mask != 0)
+			{
+#if (SYSCTRL_SHADOW_REGISTERS == 1U) || (SYSCTRL_TRACE == 1U) || (SYSCTRL_GATE_ACCESS == SYSCTRL_GATE_ACCESS_BITBAND)
+				unsigned char instance;
+
+				for (instance = 0; instance < instanceCount(periphral); instance++)
+				{
+					if (mask & (1UL << instance))
+					{
+#if (SYSCTRL_SHADOW_REGISTERS == 1U) || (SYSCTRL_TRACE == 1U)
+						if (open)
+						{
+							SysCtrl_peripheralEnable(periphral, instance);
+						}
+						else
+						{
+							SysCtrl_peripheralDisable(periphral, instance);
+						}
+#else
+						SYSCTL_REG_BIT_WRITE(SYSCTL_RCGC_OFFSET + rcgcOffset(periphral), instance, open);
+#endif
+					}
+				}
+#else
+				if (open)
+				{
+					SYSCTL_REG_MODIFY(SYSCTL_RCGC_OFFSET + rcgcOffset(periphral), 0, mask);
+				}
+				else
+				{
+					SYSCTL_REG_MODIFY(SYSCTL_RCGC_OFFSET + rcgcOffset(periphral), mask, 0);
+				}
+#endif
+			}
+			Walk<Periphral + 1>::write(open);
+		}
+	};
+
+	template <unsigned int Periphral>
+	struct Walk<Periphral, true>
+	{
+		static inline void write(unsigned char)
+		{
+		}
+	};
+};
+
+} /* namespace SysCtrl */
+#endif  /* SYSCTRL_HPP */
+
+/**********************************************************************************************************************
+ *  END OF FILE: SysCtrl.hpp
+ *********************************************************************************************************************/
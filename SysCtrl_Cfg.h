@@ -0,0 +1,144 @@
+/******************************************************************************
+ *
+ * Module: System Control
+ *
+ * File Name: SysCtrl_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header File For System Control Module
+ *
+ * Author: Sayed Mohsen
+ *
+ *******************************************************************************/
+#ifndef SYSCTRL_CFG_H
+#define SYSCTRL_CFG_H
+
+/**********************************************************************************************************************
+ *  PRE-COMPILE CONFIGURATIONS
+ *********************************************************************************************************************/
+
+/* Register Access Backend
+ * 0 -> Memory Mapped SYSCTL Block (Target)
+ * 1 -> Host Side SYSCTL Simulator (SysCtrl_sim.c) */
+#ifndef SYSCTRL_HOST_SIMULATOR
+#define SYSCTRL_HOST_SIMULATOR        (0U)
+#endif
+
+/* Run Mode Clock Gate Access
+ * SYSCTRL_GATE_ACCESS_RMW     -> read-modify-write of the RCGC register
+ * SYSCTRL_GATE_ACCESS_BITBAND -> single store to the Cortex-M4 peripheral bit-band alias (interrupt safe) */
+#define SYSCTRL_GATE_ACCESS_RMW       (0U)
+#define SYSCTRL_GATE_ACCESS_BITBAND   (1U)
+#ifndef SYSCTRL_GATE_ACCESS
+#define SYSCTRL_GATE_ACCESS           SYSCTRL_GATE_ACCESS_RMW
+#endif
+
+/* Number Of Register Accesses The Simulated PLL Needs To Lock */
+#ifndef SYSCTRL_SIM_PLL_LOCK_ACCESSES
+#define SYSCTRL_SIM_PLL_LOCK_ACCESSES (16U)
+#endif
+
+/* Allowed Distance Between Desired And Achieved System Clock (Per-Mille) */
+#define SYSCTRL_CLOCK_TOLERANCE_PERMILLE (1U)
+
+/* Core Cycles To Wait For PLL Lock Before The PLL Is Power Cycled */
+#ifndef SYSCTRL_PLL_LOCK_TIMEOUT_CYCLES
+#define SYSCTRL_PLL_LOCK_TIMEOUT_CYCLES (160000UL)
+#endif
+
+/* Core Cycles To Wait For The Main Oscillator To Power Up (MOSCPUPRIS) Before It Is Selected */
+#ifndef SYSCTRL_MOSC_POWER_UP_TIMEOUT_CYCLES
+#define SYSCTRL_MOSC_POWER_UP_TIMEOUT_CYCLES (160000UL)
+#endif
+
+/* PLL Power Cycles Before Falling Back To sysCtrl_FallbackConfig (SysCtrl_PBcfg.c) */
+#define SYSCTRL_PLL_LOCK_RETRIES      (2U)
+
+/* Main Oscillator Failure Action (MOSCCTL)
+ * SYSCTRL_MOSC_MONITOR_OFF      -> clock validation disabled
+ * SYSCTRL_MOSC_MONITOR_RESET    -> a failure resets the device (SYSCTRL_MOSC_FAILURE_RESET)
+ * SYSCTRL_MOSC_MONITOR_FAILOVER -> a failure interrupts, SysCtrl_moscFailHandler moves to sysCtrl_MoscFailoverConfig */
+#define SYSCTRL_MOSC_MONITOR_OFF      (0U)
+#define SYSCTRL_MOSC_MONITOR_RESET    (1U)
+#define SYSCTRL_MOSC_MONITOR_FAILOVER (2U)
+#ifndef SYSCTRL_MOSC_MONITOR
+#define SYSCTRL_MOSC_MONITOR          SYSCTRL_MOSC_MONITOR_OFF
+#endif
+
+/* Peripheral Ready Polls Before SysCtrl_peripheralEnableSet / SysCtrl_peripheralRecoverSet Give Up */
+#define SYSCTRL_PERIPHERAL_READY_TIMEOUT (1000UL)
+
+/* Core Cycles A Software Reset Is Held Asserted By SysCtrl_peripheralRecoverSet */
+#ifndef SYSCTRL_PERIPHERAL_RESET_HOLD_CYCLES
+#define SYSCTRL_PERIPHERAL_RESET_HOLD_CYCLES (16UL)
+#endif
+
+/* Number Of Register Accesses A Simulated Peripheral Needs To Become Ready */
+#ifndef SYSCTRL_SIM_PERIPHERAL_READY_ACCESSES
+#define SYSCTRL_SIM_PERIPHERAL_READY_ACCESSES (2U)
+#endif
+
+/* Highest Number Of Instances Tracked Per Peripheral By The Gate Reference Counts */
+#define SYSCTRL_MAX_PERIPHRAL_INSTANCES (8U)
+
+/* Record Which Owners Hold Each Gate (Debug): 0 -> Off, 1 -> On */
+#ifndef SYSCTRL_GATE_OWNER_TRACKING
+#define SYSCTRL_GATE_OWNER_TRACKING   (0U)
+#endif
+
+/* Number Of Drivers That Can Register For Clock Change Notification */
+#define SYSCTRL_CLOCK_CHANGE_CALLBACKS (4U)
+
+/* Event Trace With Cycle Counter Timestamps: 0 -> Off (trace points compile to nothing), 1 -> On */
+#ifndef SYSCTRL_TRACE
+#define SYSCTRL_TRACE                 (0U)
+#endif
+
+/* Records Kept In The Trace Ring Buffer (Power Of Two) */
+#ifndef SYSCTRL_TRACE_DEPTH
+#define SYSCTRL_TRACE_DEPTH           (64U)
+#endif
+
+/* Reset History Storage
+ * SYSCTRL_RESET_HISTORY_NOINIT  -> ring buffer in no-init RAM (survives every reset except power loss)
+ * SYSCTRL_RESET_HISTORY_HIBDATA -> ring buffer in battery backed hibernation memory (SYSCTRL_RESET_HISTORY_DEPTH <= 5) */
+#define SYSCTRL_RESET_HISTORY_NOINIT  (0U)
+#define SYSCTRL_RESET_HISTORY_HIBDATA (1U)
+#ifndef SYSCTRL_RESET_HISTORY_BACKEND
+#define SYSCTRL_RESET_HISTORY_BACKEND SYSCTRL_RESET_HISTORY_NOINIT
+#endif
+
+/* Number Of Resets Kept In The Reset History */
+#ifndef SYSCTRL_RESET_HISTORY_DEPTH
+#define SYSCTRL_RESET_HISTORY_DEPTH   (8U)
+#endif
+
+/* Linker Section Left Out Of Startup Zero / Copy Initialization */
+#ifndef SYSCTRL_NO_INIT
+#define SYSCTRL_NO_INIT               __attribute__((section(".noinit")))
+#endif
+
+/* RAM Shadow Of RCC, RCC2 And The RCGCx Registers: 0 -> Off, 1 -> On
+ * Updates are built in the shadow and written once, the slow peripheral bus is never read back.
+ * Code outside the driver writing these registers must call SysCtrl_shadowSync afterwards. */
+#ifndef SYSCTRL_SHADOW_REGISTERS
+#define SYSCTRL_SHADOW_REGISTERS      (0U)
+#endif
+
+/* Compare Shadow And Hardware After Every Shadowed Write: 0 -> Off, 1 -> On (debug builds) */
+#ifndef SYSCTRL_SHADOW_CHECK
+#define SYSCTRL_SHADOW_CHECK          (0U)
+#endif
+
+/* Number Of Clock Profiles In sysCtrl_Profiles (SysCtrl_PBcfg.c) */
+#define SYSCTRL_NUM_OF_PROFILES       (3U)
+
+/* Clock Profile Indexes */
+#define SYSCTRL_PROFILE_PERFORMANCE   (0U)
+#define SYSCTRL_PROFILE_BALANCED      (1U)
+#define SYSCTRL_PROFILE_IDLE          (2U)
+
+#endif  /* SYSCTRL_CFG_H */
+
+/**********************************************************************************************************************
+ *  END OF FILE: SysCtrl_Cfg.h
+ *********************************************************************************************************************/
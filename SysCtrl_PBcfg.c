@@ -1,7 +1,44 @@
-#include "SysCtrl.h"
-
-
-
-
-
-SysCtrl_configType sysCtrl_Config ={CLOCK_SOURCE_MAIN_OSCILLATOR,XTAL_16MHZ,PLL_OPERATING_NORMALLY,PLL_400MHZ,80000000UL};
+#include "SysCtrl.h"
+#include "SysCtrl_clockTree.h"
+#include "SysCtrl_governor.h"
+
+
+
+
+
+SysCtrl_configType sysCtrl_Config =SYSCTRL_CLOCK_CONFIG(CLOCK_SOURCE_MAIN_OSCILLATOR,XTAL_16MHZ,PLL_OPERATING_NORMALLY,PLL_400MHZ,80000000UL);
+
+/*Runtime Clock Profiles Used By SysCtrl_switchProfile .. indexed by SYSCTRL_PROFILE_xxx (SysCtrl_Cfg.h)*/
+const SysCtrl_profileType sysCtrl_Profiles[SYSCTRL_NUM_OF_PROFILES] =
+{
+	{
+		"performance 80 MHz PLL", /*Burst Processing*/
+		SYSCTRL_CLOCK_CONFIG(CLOCK_SOURCE_MAIN_OSCILLATOR,XTAL_16MHZ,PLL_OPERATING_NORMALLY,PLL_400MHZ,80000000UL),
+		{{ [SYSCTL_CADC] = 0x1, [SYSCTL_CPWM] = 0x1 }},
+		{{ 0 }},
+	},
+	{
+		"balanced 16 MHz MOSC", /*Between Bursts*/
+		SYSCTRL_CLOCK_CONFIG(CLOCK_SOURCE_MAIN_OSCILLATOR,XTAL_16MHZ,PLL_POWERED_DOWM,PLL_400MHZ,16000000UL),
+		{{ [SYSCTL_CADC] = 0x1 }},
+		{{ [SYSCTL_CPWM] = 0x1 }},
+	},
+	{
+		"idle 30 kHz LFIOSC", /*Waiting For The Next Burst*/
+		SYSCTRL_CLOCK_CONFIG(CLOCK_SOURCE_LOW_FREQUENCY_INTERNAL_OSCILLATOR,XTAL_16MHZ,PLL_POWERED_DOWM,PLL_400MHZ,30000UL),
+		{{ 0 }},
+		{{ [SYSCTL_CADC] = 0x1, [SYSCTL_CPWM] = 0x1 }},
+	},
+};
+
+/*Clock Used After A Main Oscillator Failure (SYSCTRL_MOSC_MONITOR_FAILOVER) .. PLL on the PIOSC reference*/
+const SysCtrl_configType sysCtrl_MoscFailoverConfig =SYSCTRL_CLOCK_CONFIG(CLOCK_SOURCE_PRECISION_INTERNAL_OSCILLATOR,XTAL_16MHZ,PLL_OPERATING_NORMALLY,PLL_400MHZ,80000000UL);
+
+/*Clock Governor .. ondemand, raise at 80% load, lower below 30% after 4 samples of 100 ticks*/
+const SysCtrl_governorConfigType sysCtrl_GovernorConfig = {SYSCTRL_GOVERNOR_ONDEMAND, 80, 30, 70, 4, 100, SYSCTRL_PROFILE_PERFORMANCE};
+
+/*Deep-Sleep Clock .. PIOSC Keeps Wake Latency Short, MOSC And PLL Are Powered Down*/
+const SysCtrl_deepSleepConfigType sysCtrl_DeepSleepConfig = {CLOCK_SOURCE_PRECISION_INTERNAL_OSCILLATOR, 1};
+
+/*Clock Used When The PLL Fails To Lock .. must not use the PLL*/
+const SysCtrl_configType sysCtrl_FallbackConfig =SYSCTRL_CLOCK_CONFIG(CLOCK_SOURCE_PRECISION_INTERNAL_OSCILLATOR,XTAL_16MHZ,PLL_POWERED_DOWM,PLL_400MHZ,16000000UL);
@@ -0,0 +1,171 @@
+/******************************************************************************
+ *
+ * Module: System Control
+ *
+ * File Name: SysCtrl_clockTree.h
+ *
+ * Description: Build Time Clock Tree Solver
+ * Resolves a clock configuration into the final RCC/RCC2 register images and the exact
+ * achieved system clock using constant expressions only, so SysCtrl_initSystemClock is
+ * reduced to a few straight stores. A configuration that is out of range or not reachable
+ * within SYSCTRL_CLOCK_TOLERANCE_PERMILLE fails the build ("negative array size").
+ * SysCtrl_planSystemClock mirrors these expressions at runtime using the crystal table in SysCtrl.c.
+ *
+ * Author: Sayed Mohsen
+ *
+ *******************************************************************************/
+#ifndef SYSCTRL_CLOCKTREE_H
+#define SYSCTRL_CLOCKTREE_H
+
+/**********************************************************************************************************************
+ * INCLUDES
+ *********************************************************************************************************************/
+#include "SysCtrl.h"
+
+/**********************************************************************************************************************
+ *  GLOBAL CONSTANT MACROS
+ *********************************************************************************************************************/
+
+/*Oscillator And PLL Frequencies (Hz)*/
+#define SYSCTRL_PIOSC_HZ          (16000000UL)
+#define SYSCTRL_PIOSC_DIV_4_HZ    (4000000UL)
+#define SYSCTRL_LFIOSC_HZ         (30000UL)
+#define SYSCTRL_XTAL32K_HZ        (32768UL)
+#define SYSCTRL_PLL_400_HZ        (400000000UL)
+#define SYSCTRL_PLL_200_HZ        (200000000UL)
+#define SYSCTRL_MAX_SYSTEM_HZ     (80000000UL)
+#define SYSCTRL_PLL_MIN_INPUT_HZ  (5000000UL)  /*Crystals Below 5 MHz Cannot Feed The PLL*/
+#define SYSCTRL_USB_HZ            (60000000UL) /*USB Clock From The USB PLL (USBPWRDN Clear)*/
+
+/*RCC Fields Owned By The Clock Tree*/
+#define SYSCTRL_RCC_MOSCDIS       (0x00000001UL)
+#define SYSCTRL_RCC_USESYSDIV     (0x00400000UL)
+#define SYSCTRL_RCC_CLOCK_M       (SYSCTRL_RCC_MOSCDIS | 0x000007C0UL | SYSCTRL_RCC_USESYSDIV)
+
+/*RCC2 Fields*/
+#define SYSCTRL_RCC2_USERCC2      (0x80000000UL)
+#define SYSCTRL_RCC2_DIV400       (0x40000000UL)
+#define SYSCTRL_RCC2_USBPWRDN     (0x00004000UL)
+#define SYSCTRL_RCC2_PWRDN2       (0x00002000UL)
+#define SYSCTRL_RCC2_BYPASS2      (0x00000800UL)
+#define SYSCTRL_RCC2_SYSDIV2_S    (23)
+#define SYSCTRL_RCC2_SYSDIV2LSB_S (22)
+
+/*Attached Crystal Frequency*/
+#define SYSCTRL_XTAL_HZ(xtal)                   \
+	(((xtal) == XTAL_4MHZ)    ? 4000000UL  :    \
+	 ((xtal) == XTAL_4_09MHZ) ? 4096000UL  :    \
+	 ((xtal) == XTAL_4_91MHZ) ? 4915200UL  :    \
+	 ((xtal) == XTAL_5MHZ)    ? 5000000UL  :    \
+	 ((xtal) == XTAL_5_12MHZ) ? 5120000UL  :    \
+	 ((xtal) == XTAL_6MHZ)    ? 6000000UL  :    \
+	 ((xtal) == XTAL_6_14MHZ) ? 6144000UL  :    \
+	 ((xtal) == XTAL_7_37MHZ) ? 7372800UL  :    \
+	 ((xtal) == XTAL_8MHZ)    ? 8000000UL  :    \
+	 ((xtal) == XTAL_8_19MHZ) ? 8192000UL  :    \
+	 ((xtal) == XTAL_10MHZ)   ? 10000000UL :    \
+	 ((xtal) == XTAL_12MHZ)   ? 12000000UL :    \
+	 ((xtal) == XTAL_12_2MHZ) ? 12288000UL :    \
+	 ((xtal) == XTAL_13_5MHZ) ? 13560000UL :    \
+	 ((xtal) == XTAL_14_3MHZ) ? 14318180UL :    \
+	 ((xtal) == XTAL_16MHZ)   ? 16000000UL :    \
+	 ((xtal) == XTAL_16_3MHZ) ? 16384000UL :    \
+	 ((xtal) == XTAL_18MHZ)   ? 18000000UL :    \
+	 ((xtal) == XTAL_20MHZ)   ? 20000000UL :    \
+	 ((xtal) == XTAL_24MHZ)   ? 24000000UL : 25000000UL)
+
+/*RCC XTAL Field Value (SYSCTL_RCC_XTAL_xxx)*/
+#define SYSCTRL_XTAL_FIELD(xtal)  (SYSCTL_RCC_XTAL_4MHZ + ((unsigned long)(xtal) << 6))
+
+/*Oscillator Clock*/
+#define SYSCTRL_OSC_HZ(src, xtal)                                                   \
+	(((src) == CLOCK_SOURCE_MAIN_OSCILLATOR)                        ? SYSCTRL_XTAL_HZ(xtal) : \
+	 ((src) == CLOCK_SOURCE_PRECISION_INTERNAL_OSCILLATOR)          ? SYSCTRL_PIOSC_HZ       : \
+	 ((src) == CLOCK_SOURCE_PRECISION_INTERNAL_OSCILLATOR_DIVDED_4) ? SYSCTRL_PIOSC_DIV_4_HZ : \
+	 ((src) == CLOCK_SOURCE_LOW_FREQUENCY_INTERNAL_OSCILLATOR)      ? SYSCTRL_LFIOSC_HZ      : SYSCTRL_XTAL32K_HZ)
+
+/*PLL 400 MHz Output Feeds A 7 Bit Divisor (SYSDIV2:SYSDIV2LSB), Otherwise A 6 Bit SYSDIV2*/
+#define SYSCTRL_USES_PLL(plluse)        ((plluse) == PLL_OPERATING_NORMALLY)
+#define SYSCTRL_USES_DIV400(plluse, pll) (SYSCTRL_USES_PLL(plluse) && ((pll) == PLL_400MHZ))
+#define SYSCTRL_MAX_DIVISOR(plluse, pll) (SYSCTRL_USES_DIV400(plluse, pll) ? 128UL : 64UL)
+
+/*Clock Entering The System Divisor*/
+#define SYSCTRL_DIV_INPUT_HZ(src, xtal, plluse, pll)                                 \
+	(SYSCTRL_USES_PLL(plluse) ? (((pll) == PLL_400MHZ) ? SYSCTRL_PLL_400_HZ : SYSCTRL_PLL_200_HZ) \
+	                          : SYSCTRL_OSC_HZ(src, xtal))
+
+/*Nearest Divisor (At Least 1)*/
+#define SYSCTRL_RAW_DIVISOR(src, xtal, plluse, pll, clk) \
+	((SYSCTRL_DIV_INPUT_HZ(src, xtal, plluse, pll) + ((clk) / 2UL)) / (clk))
+#define SYSCTRL_DIVISOR(src, xtal, plluse, pll, clk) \
+	((SYSCTRL_RAW_DIVISOR(src, xtal, plluse, pll, clk) == 0UL) ? 1UL : SYSCTRL_RAW_DIVISOR(src, xtal, plluse, pll, clk))
+
+/*Exact Achieved System Clock*/
+#define SYSCTRL_ACHIEVED_HZ(src, xtal, plluse, pll, clk) \
+	(SYSCTRL_DIV_INPUT_HZ(src, xtal, plluse, pll) / SYSCTRL_DIVISOR(src, xtal, plluse, pll, clk))
+
+#define SYSCTRL_ABS_DIFF(a, b)    (((a) > (b)) ? ((a) - (b)) : ((b) - (a)))
+
+/*Configuration Checks*/
+#define SYSCTRL_CLOCK_VALID(src, xtal, plluse, pll, clk)                                                   \
+	((SYSCTRL_DIVISOR(src, xtal, plluse, pll, clk) <= SYSCTRL_MAX_DIVISOR(plluse, pll)) &&                  \
+	 (SYSCTRL_ACHIEVED_HZ(src, xtal, plluse, pll, clk) <= SYSCTRL_MAX_SYSTEM_HZ) &&                          \
+	 ((!SYSCTRL_USES_PLL(plluse)) || ((src) == CLOCK_SOURCE_PRECISION_INTERNAL_OSCILLATOR) ||              \
+	  (((src) == CLOCK_SOURCE_MAIN_OSCILLATOR) && (SYSCTRL_XTAL_HZ(xtal) >= SYSCTRL_PLL_MIN_INPUT_HZ))) &&   \
+	 (SYSCTRL_ABS_DIFF(SYSCTRL_ACHIEVED_HZ(src, xtal, plluse, pll, clk), (clk)) <=                          \
+	  (((clk) / 1000UL) * SYSCTRL_CLOCK_TOLERANCE_PERMILLE)))
+
+/*Build Fails Here When The Configuration Is Not Valid*/
+#define SYSCTRL_CLOCK_ASSERT(src, xtal, plluse, pll, clk) \
+	(0UL * sizeof(char[SYSCTRL_CLOCK_VALID(src, xtal, plluse, pll, clk) ? 1 : -1]))
+
+/*USB Needs The PLL Running From A Crystal Of At Least 5 MHz (PIOSC Is Not Accurate Enough)*/
+#define SYSCTRL_USB_VALID(src, xtal, plluse) \
+	(SYSCTRL_USES_PLL(plluse) && ((src) == CLOCK_SOURCE_MAIN_OSCILLATOR) && (SYSCTRL_XTAL_HZ(xtal) >= SYSCTRL_PLL_MIN_INPUT_HZ))
+#define SYSCTRL_USB_ASSERT(src, xtal, plluse) \
+	(0UL * sizeof(char[SYSCTRL_USB_VALID(src, xtal, plluse) ? 1 : -1]))
+
+/*RCC Image .. MOSC Enabled Only When Used, PIOSC Feeds The PLL As A 16 MHz Reference*/
+#define SYSCTRL_RCC_IMAGE(src, xtal)                                                         \
+	(SYSCTRL_RCC_USESYSDIV |                                                                 \
+	 (((src) == CLOCK_SOURCE_MAIN_OSCILLATOR) ? SYSCTRL_XTAL_FIELD(xtal)                      \
+	                                          : (SYSCTL_RCC_XTAL_16MHZ | SYSCTRL_RCC_MOSCDIS)))
+
+/*RCC2 Image For A Given Divisor .. Final State, BYPASS2 Kept Only When The PLL Is Not Used*/
+#define SYSCTRL_RCC2_IMAGE_DIV(src, plluse, pll, div)                                                    \
+	(SYSCTRL_RCC2_USERCC2 | SYSCTRL_RCC2_USBPWRDN | ((unsigned long)(src) << 4) |                          \
+	 (SYSCTRL_USES_DIV400(plluse, pll)                                                                     \
+	      ? (SYSCTRL_RCC2_DIV400 | (((unsigned long)(div) - 1UL) << SYSCTRL_RCC2_SYSDIV2LSB_S))            \
+	      : (((unsigned long)(div) - 1UL) << SYSCTRL_RCC2_SYSDIV2_S)) |                                    \
+	 (SYSCTRL_USES_PLL(plluse) ? 0UL : (SYSCTRL_RCC2_PWRDN2 | SYSCTRL_RCC2_BYPASS2)))
+
+/*RCC2 Image For A Desired Clock*/
+#define SYSCTRL_RCC2_IMAGE(src, xtal, plluse, pll, clk) \
+	SYSCTRL_RCC2_IMAGE_DIV(src, plluse, pll, SYSCTRL_DIVISOR(src, xtal, plluse, pll, clk))
+
+/*SysCtrl_configType Initializer .. USB PLL powered down*/
+#define SYSCTRL_CLOCK_CONFIG(src, xtal, plluse, pll, clk)                 \
+	{                                                                     \
+		(src), (xtal), (plluse), (pll), (clk),                            \
+		SYSCTRL_RCC_IMAGE(src, xtal),                                     \
+		SYSCTRL_RCC2_IMAGE(src, xtal, plluse, pll, clk),                  \
+		SYSCTRL_ACHIEVED_HZ(src, xtal, plluse, pll, clk) +                \
+			SYSCTRL_CLOCK_ASSERT(src, xtal, plluse, pll, clk)             \
+	}
+
+/*SysCtrl_configType Initializer With The USB PLL Running (SysCtrl_getUsbClock)*/
+#define SYSCTRL_CLOCK_CONFIG_USB(src, xtal, plluse, pll, clk)             \
+	{                                                                     \
+		(src), (xtal), (plluse), (pll), (clk),                            \
+		SYSCTRL_RCC_IMAGE(src, xtal),                                     \
+		SYSCTRL_RCC2_IMAGE(src, xtal, plluse, pll, clk) & ~SYSCTRL_RCC2_USBPWRDN, \
+		SYSCTRL_ACHIEVED_HZ(src, xtal, plluse, pll, clk) +                \
+			SYSCTRL_CLOCK_ASSERT(src, xtal, plluse, pll, clk) +           \
+			SYSCTRL_USB_ASSERT(src, xtal, plluse)                         \
+	}
+
+#endif  /* SYSCTRL_CLOCKTREE_H */
+
+/**********************************************************************************************************************
+ *  END OF FILE: SysCtrl_clockTree.h
+ *********************************************************************************************************************/
@@ -0,0 +1,347 @@
+/******************************************************************************
+ *
+ * Module: System Control
+ *
+ * File Name: SysCtrl_governor.c
+ *
+ * Description: Load Driven Clock Governor
+ * SysCtrl_governorTick (tick ISR) counts busy / idle ticks and turns every sampleTicks
+ * ticks into a load sample. The active policy picks a target profile from the ladder of
+ * sysCtrl_Profiles sorted by clock, and SysCtrl_governorMainFunction (thread context)
+ * switches to it, so the PLL relock never runs inside the tick ISR.
+ * On the host, recorded load traces can be replayed through SysCtrl_governorSample.
+ *
+ * Author: Sayed Mohsen
+ *
+ *******************************************************************************/
+#include "SysCtrl.h"
+#include "SysCtrl_governor.h"
+
+/**********************************************************************************************************************
+ *  LOCAL DATA TYPES AND STRUCTURES
+ *********************************************************************************************************************/
+
+/*Policy .. maps a load sample to a ladder level*/
+typedef unsigned char (*SysCtrl_governorPolicyFuncType)(unsigned char load);
+
+/**********************************************************************************************************************
+*  LOCAL FUNCTION
+*********************************************************************************************************************/
+static unsigned char SysCtrl_governorOndemand(unsigned char load);
+static unsigned char SysCtrl_governorConservative(unsigned char load);
+static unsigned char SysCtrl_governorFixed(unsigned char load);
+static unsigned char SysCtrl_governorLevelOf(SysCtrl_profileIdType profileId);
+
+/**********************************************************************************************************************
+ *  GLOBAL DATA
+ *********************************************************************************************************************/
+
+/*global Variable To Hold Governor Configurations */
+static const SysCtrl_governorConfigType *g_governorConfig = (void *)0;
+static SysCtrl_governorPolicyType g_governorPolicy = SYSCTRL_GOVERNOR_FIXED;
+
+/*Policies Indexed By SysCtrl_governorPolicyType*/
+static const SysCtrl_governorPolicyFuncType g_governorPolicies[SYSCTRL_GOVERNOR_NUM_OF_POLICIES] =
+{
+	SysCtrl_governorOndemand,
+	SysCtrl_governorConservative,
+	SysCtrl_governorFixed
+};
+
+/*Profile Ladder .. sysCtrl_Profiles indexes sorted by achieved clock, slowest first*/
+static SysCtrl_profileIdType g_ladder[SYSCTRL_NUM_OF_PROFILES];
+
+/*Current And Requested Ladder Level*/
+static unsigned char g_level = 0;
+static volatile unsigned char g_targetLevel = 0;
+
+/*Consecutive Samples Asking For A Slower Profile*/
+static unsigned char g_lowSamples = 0;
+
+/*Load Sampling Window*/
+static volatile unsigned char g_cpuIdle = 0;
+static unsigned long g_windowTicks = 0;
+static unsigned long g_windowIdleTicks = 0;
+
+static SysCtrl_governorStatsType g_governorStats;
+
+
+/******************************************************************************
+* \Syntax          : SysCtrl_returnType SysCtrl_governorInit(const SysCtrl_governorConfigType *config_ptr)
+* \Description     : Build The Profile Ladder And Start Governing From The Current Clock
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : config_ptr -> governor configurations (sysCtrl_GovernorConfig)
+* \Parameters (out): SYSCTRL_E_OK / SYSCTRL_E_NOT_OK
+*******************************************************************************/
+SysCtrl_returnType SysCtrl_governorInit(const SysCtrl_governorConfigType *config_ptr)
+{
+	SysCtrl_systemClock systemClock = SysCtrl_getSystemClock();
+	SysCtrl_profileIdType profileId;
+	unsigned char index;
+	unsigned char level;
+
+	if ((config_ptr == (void *)0) || (config_ptr->policy >= SYSCTRL_GOVERNOR_NUM_OF_POLICIES) ||
+	    (config_ptr->downThreshold >= config_ptr->upThreshold) || (config_ptr->upThreshold > 100) ||
+	    (config_ptr->targetLoad == 0) || (config_ptr->targetLoad > 100) ||
+	    (config_ptr->sampleTicks == 0) || (config_ptr->fixedProfile >= SYSCTRL_NUM_OF_PROFILES))
+	{
+		return SYSCTRL_E_NOT_OK;
+	}
+
+	/*Insertion Sort .. done once, the ladder is a handful of entries*/
+	for (profileId = 0; profileId < SYSCTRL_NUM_OF_PROFILES; profileId++)
+	{
+		for (index = profileId; (index > 0) &&
+		     (sysCtrl_Profiles[g_ladder[index - 1]].clock.achievedClock > sysCtrl_Profiles[profileId].clock.achievedClock); index--)
+		{
+			g_ladder[index] = g_ladder[index - 1];
+		}
+		g_ladder[index] = profileId;
+	}
+
+	/*Start On The Slowest Level Not Below The Current Clock*/
+	for (level = 0; (level < (SYSCTRL_NUM_OF_PROFILES - 1)) &&
+	     (sysCtrl_Profiles[g_ladder[level]].clock.achievedClock < systemClock); level++)
+	{
+	}
+
+	g_governorConfig = config_ptr;
+	g_governorPolicy = config_ptr->policy;
+	g_level = level;
+	g_targetLevel = level;
+	g_lowSamples = 0;
+	g_windowTicks = 0;
+	g_windowIdleTicks = 0;
+	return SYSCTRL_E_OK;
+}
+
+/******************************************************************************
+* \Syntax          : SysCtrl_returnType SysCtrl_governorSetPolicy(SysCtrl_governorPolicyType policy)
+* \Description     : Change The Governor Policy At Runtime
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : policy -> ondemand, conservative or fixed
+* \Parameters (out): SYSCTRL_E_OK / SYSCTRL_E_NOT_OK
+*******************************************************************************/
+SysCtrl_returnType SysCtrl_governorSetPolicy(SysCtrl_governorPolicyType policy)
+{
+	if ((g_governorConfig == (void *)0) || (policy >= SYSCTRL_GOVERNOR_NUM_OF_POLICIES))
+	{
+		return SYSCTRL_E_NOT_OK;
+	}
+	g_governorPolicy = policy;
+	g_lowSamples = 0;
+	return SYSCTRL_E_OK;
+}
+
+/******************************************************************************
+* \Syntax          : void SysCtrl_governorSetIdle(unsigned char idle)
+* \Description     : Mark The CPU Idle Around The Idle Loop WFI .. ticks taken while idle count as idle
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : idle -> 1 entering idle, 0 leaving idle
+* \Parameters (out): None
+*******************************************************************************/
+void SysCtrl_governorSetIdle(unsigned char idle)
+{
+	g_cpuIdle = idle;
+}
+
+/******************************************************************************
+* \Syntax          : void SysCtrl_governorTick(void)
+* \Description     : Tick Hook .. call from the system tick ISR
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+*******************************************************************************/
+void SysCtrl_governorTick(void)
+{
+	SysCtrl_profileIdType profileId = SysCtrl_getProfile();
+
+	if (g_governorConfig == (void *)0)
+	{
+		return;
+	}
+
+	if (profileId < SYSCTRL_NUM_OF_PROFILES)
+	{
+		g_governorStats.ticksAtProfile[profileId]++;
+	}
+
+	g_windowTicks++;
+	if (g_cpuIdle)
+	{
+		g_windowIdleTicks++;
+	}
+
+	if (g_windowTicks >= g_governorConfig->sampleTicks)
+	{
+		SysCtrl_governorSample(g_windowTicks - g_windowIdleTicks, g_windowTicks);
+		g_windowTicks = 0;
+		g_windowIdleTicks = 0;
+	}
+}
+
+/******************************************************************************
+* \Syntax          : void SysCtrl_governorSample(unsigned long busyTicks, unsigned long totalTicks)
+* \Description     : Feed One Load Sample And Pick The Target Profile .. lowering the clock
+*                    needs downSamples consecutive samples asking for it
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : busyTicks / totalTicks -> load over the sample window
+* \Parameters (out): None
+*******************************************************************************/
+void SysCtrl_governorSample(unsigned long busyTicks, unsigned long totalTicks)
+{
+	unsigned char load;
+	unsigned char level;
+
+	if ((g_governorConfig == (void *)0) || (totalTicks == 0))
+	{
+		return;
+	}
+
+	load = (busyTicks >= totalTicks) ? 100 : (unsigned char)((busyTicks * 100UL) / totalTicks);
+	g_governorStats.samples++;
+	g_governorStats.lastLoad = load;
+
+	level = g_governorPolicies[g_governorPolicy](load);
+
+	if ((level < g_level) && (g_governorPolicy != SYSCTRL_GOVERNOR_FIXED))
+	{
+		if (++g_lowSamples < g_governorConfig->downSamples)
+		{
+			level = g_level;
+		}
+		else
+		{
+			g_lowSamples = 0;
+		}
+	}
+	else
+	{
+		g_lowSamples = 0;
+	}
+
+	g_targetLevel = level;
+}
+
+/******************************************************************************
+* \Syntax          : SysCtrl_returnType SysCtrl_governorMainFunction(void)
+* \Description     : Switch To The Profile Chosen By The Last Sample .. call from thread context
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): SYSCTRL_E_OK / SysCtrl_switchProfile error (target dropped until the next sample)
+*******************************************************************************/
+SysCtrl_returnType SysCtrl_governorMainFunction(void)
+{
+	unsigned char level = g_targetLevel;
+	SysCtrl_returnType status;
+
+	if ((g_governorConfig == (void *)0) || (level == g_level))
+	{
+		return SYSCTRL_E_OK;
+	}
+
+	status = SysCtrl_switchProfile(g_ladder[level]);
+	if (status == SYSCTRL_E_OK)
+	{
+		g_level = level;
+		g_governorStats.transitions++;
+	}
+	else
+	{
+		g_targetLevel = g_level;
+	}
+	return status;
+}
+
+/******************************************************************************
+* \Syntax          : void SysCtrl_governorGetStats(SysCtrl_governorStatsType *stats_ptr)
+* \Description     : Read Time Spent On Each Profile, Transitions And The Last Load
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): stats_ptr -> copy of the statistics
+*******************************************************************************/
+void SysCtrl_governorGetStats(SysCtrl_governorStatsType *stats_ptr)
+{
+	if (stats_ptr != (void *)0)
+	{
+		*stats_ptr = g_governorStats;
+	}
+}
+
+/******************************************************************************
+* \Syntax          : static unsigned char SysCtrl_governorOndemand(unsigned char load)
+* \Description     : Fastest Level At upThreshold, Slowest Level Keeping The Load Under
+*                    targetLoad Below downThreshold, Otherwise Stay
+*******************************************************************************/
+static unsigned char SysCtrl_governorOndemand(unsigned char load)
+{
+	SysCtrl_systemClock required;
+	unsigned char level;
+
+	if (load >= g_governorConfig->upThreshold)
+	{
+		return (SYSCTRL_NUM_OF_PROFILES - 1);
+	}
+	if (load >= g_governorConfig->downThreshold)
+	{
+		return g_level;
+	}
+
+	required = (sysCtrl_Profiles[g_ladder[g_level]].clock.achievedClock / g_governorConfig->targetLoad) * load;
+	for (level = 0; (level < g_level) && (sysCtrl_Profiles[g_ladder[level]].clock.achievedClock < required); level++)
+	{
+	}
+	return level;
+}
+
+/******************************************************************************
+* \Syntax          : static unsigned char SysCtrl_governorConservative(unsigned char load)
+* \Description     : One Level Up At upThreshold, One Level Down Below downThreshold
+*******************************************************************************/
+static unsigned char SysCtrl_governorConservative(unsigned char load)
+{
+	if ((load >= g_governorConfig->upThreshold) && (g_level < (SYSCTRL_NUM_OF_PROFILES - 1)))
+	{
+		return (unsigned char)(g_level + 1);
+	}
+	if ((load < g_governorConfig->downThreshold) && (g_level > 0))
+	{
+		return (unsigned char)(g_level - 1);
+	}
+	return g_level;
+}
+
+/******************************************************************************
+* \Syntax          : static unsigned char SysCtrl_governorFixed(unsigned char load)
+* \Description     : Level Of fixedProfile Whatever The Load
+*******************************************************************************/
+static unsigned char SysCtrl_governorFixed(unsigned char load)
+{
+	(void)load;
+	return SysCtrl_governorLevelOf(g_governorConfig->fixedProfile);
+}
+
+/******************************************************************************
+* \Syntax          : static unsigned char SysCtrl_governorLevelOf(SysCtrl_profileIdType profileId)
+* \Description     : Ladder Level Of A Profile
+*******************************************************************************/
+static unsigned char SysCtrl_governorLevelOf(SysCtrl_profileIdType profileId)
+{
+	unsigned char level;
+
+	for (level = 0; (level < (SYSCTRL_NUM_OF_PROFILES - 1)) && (g_ladder[level] != profileId); level++)
+	{
+	}
+	return level;
+}
+
+/**********************************************************************************************************************
+ *  END OF FILE: SysCtrl_governor.c
+ *********************************************************************************************************************/
@@ -0,0 +1,72 @@
+/******************************************************************************
+ *
+ * Module: System Control
+ *
+ * File Name: SysCtrl_governor.h
+ *
+ * Description: Header File For The Load Driven Clock Governor
+ * Samples CPU load from a tick hook and moves between the clock profiles in
+ * sysCtrl_Profiles, choosing the slowest profile that keeps the load under a target.
+ *
+ * Author: Sayed Mohsen
+ *
+ *******************************************************************************/
+#ifndef SYSCTRL_GOVERNOR_H
+#define SYSCTRL_GOVERNOR_H
+
+/**********************************************************************************************************************
+ * INCLUDES
+ *********************************************************************************************************************/
+#include "SysCtrl.h"
+
+/**********************************************************************************************************************
+ *  GLOBAL DATA TYPES AND STRUCTURES
+ *********************************************************************************************************************/
+
+/*Type Definitions For Governor Policy*/
+typedef enum {
+	SYSCTRL_GOVERNOR_ONDEMAND,/*Jump To The Fastest Profile Above upThreshold, Else The Slowest One Meeting targetLoad*/
+	SYSCTRL_GOVERNOR_CONSERVATIVE,/*Step One Profile Up Or Down At A Time*/
+	SYSCTRL_GOVERNOR_FIXED,/*Stay On fixedProfile*/
+	SYSCTRL_GOVERNOR_NUM_OF_POLICIES
+}SysCtrl_governorPolicyType;
+
+/*Governor Configurations*/
+typedef struct {
+	SysCtrl_governorPolicyType policy;
+	unsigned char upThreshold;/*Load % At Or Above Which The Clock Is Raised*/
+	unsigned char downThreshold;/*Load % Below Which The Clock May Be Lowered*/
+	unsigned char targetLoad;/*Load % The Chosen Clock Must Keep Under (ondemand)*/
+	unsigned char downSamples;/*Consecutive Low Load Samples Before The Clock Is Lowered*/
+	unsigned short sampleTicks;/*Ticks Per Load Sample*/
+	SysCtrl_profileIdType fixedProfile;
+}SysCtrl_governorConfigType;
+
+/*Governor Statistics*/
+typedef struct {
+	unsigned long ticksAtProfile[SYSCTRL_NUM_OF_PROFILES];/*Time Spent On Each Profile In Ticks*/
+	unsigned long transitions;
+	unsigned long samples;
+	unsigned char lastLoad;/*Load % Of The Last Sample*/
+}SysCtrl_governorStatsType;
+
+/**********************************************************************************************************************
+ *  GLOBAL DATA PROTOTYPES
+ *********************************************************************************************************************/
+extern const SysCtrl_governorConfigType sysCtrl_GovernorConfig;
+
+/**********************************************************************************************************************
+ *  GLOBAL FUNCTION PROTOTYPES
+ *********************************************************************************************************************/
+SysCtrl_returnType SysCtrl_governorInit(const SysCtrl_governorConfigType *config_ptr);
+SysCtrl_returnType SysCtrl_governorSetPolicy(SysCtrl_governorPolicyType policy);
+void SysCtrl_governorSetIdle(unsigned char idle);
+void SysCtrl_governorTick(void);
+void SysCtrl_governorSample(unsigned long busyTicks, unsigned long totalTicks);
+SysCtrl_returnType SysCtrl_governorMainFunction(void);
+void SysCtrl_governorGetStats(SysCtrl_governorStatsType *stats_ptr);
+#endif  /* SYSCTRL_GOVERNOR_H */
+
+/**********************************************************************************************************************
+ *  END OF FILE: SysCtrl_governor.h
+ *********************************************************************************************************************/
@@ -1,47 +1,148 @@
-#ifndef SYSCTR_MAP_H
-#define SYSCTR_MAP_H
-
-
-/*Run Mode Clock Gating Control*/
-#define SYSCTL_RCGCBASE   0x400fe600
-
-
-#define SYSCTL_RCGCWD_R_OFFSET         0x00
-#define SYSCTL_RCGCTIMER_R_OFFSET      0x04
-#define SYSCTL_RCGCGPIO_R_OFFSET       0x08
-#define SYSCTL_RCGCDMA_R_OFFSET        0x0C
-#define SYSCTL_RCGCHIB_R_OFFSET        0x14
-#define SYSCTL_RCGCUART_R_OFFSET       0x18
-#define SYSCTL_RCGCSSI_R_OFFSET        0x1C
-#define SYSCTL_RCGCI2C_R_OFFSET        0x20
-#define SYSCTL_RCGCUSB_R_OFFSET        0x28
-#define SYSCTL_RCGCCAN_R_OFFSET        0x34
-#define SYSCTL_RCGCADC_R_OFFSET        0x38
-#define SYSCTL_RCGCACMP_R_OFFSET       0x3C
-#define SYSCTL_RCGCPWM_R_OFFSET        0x40
-#define SYSCTL_RCGCQEI_R_OFFSET        0x44
-#define SYSCTL_RCGCEEPROM_R_OFFSET     0x58
-#define SYSCTL_RCGCWTIMER_R_OFFSET     0x5C
-	
-
-
-#define SYSCTL_RCC_R            (*((volatile unsigned long *)0x400FE060))
-#define SYSCTL_RCC_XTAL_M       0x000007C0  // Crystal Value
-#define MOSCDIS 0
-
-
-#define SYSCTL_RCC2_R				(*((volatile  unsigned long *)0x400FE070))
-#define PWRDN2 13
-#define BYPASS2 11
-#define DIV400 30 
-#define SYSCTL_RCC2_USERCC2     0x80000000  // Use RCC2
-
-#define SYSCTL_RIS_R            (*((volatile  unsigned long*)0x400FE050))
-#define PLLLRIS 6
-
-#define SYSCTL_PLLSTAT_R        (*((volatile  unsigned long *)0x400FE168))
-#define SYSCTL_RESC_R           (*((volatile unsigned long *)0x400FE05C))
-
-
-
-#endif 
+#ifndef SYSCTR_MAP_H
+#define SYSCTR_MAP_H
+
+#include "SysCtrl_Cfg.h"
+
+/*System Control Base Address*/
+#define SYSCTL_BASE       0x400FE000
+
+/*Run Mode Clock Gating Control*/
+#define SYSCTL_RCGCBASE   0x400fe600
+#define SYSCTL_RCGC_OFFSET  0x600
+
+
+#define SYSCTL_RCGCWD_R_OFFSET         0x00
+#define SYSCTL_RCGCTIMER_R_OFFSET      0x04
+#define SYSCTL_RCGCGPIO_R_OFFSET       0x08
+#define SYSCTL_RCGCDMA_R_OFFSET        0x0C
+#define SYSCTL_RCGCHIB_R_OFFSET        0x14
+#define SYSCTL_RCGCUART_R_OFFSET       0x18
+#define SYSCTL_RCGCSSI_R_OFFSET        0x1C
+#define SYSCTL_RCGCI2C_R_OFFSET        0x20
+#define SYSCTL_RCGCUSB_R_OFFSET        0x28
+#define SYSCTL_RCGCCAN_R_OFFSET        0x34
+#define SYSCTL_RCGCADC_R_OFFSET        0x38
+#define SYSCTL_RCGCACMP_R_OFFSET       0x3C
+#define SYSCTL_RCGCPWM_R_OFFSET        0x40
+#define SYSCTL_RCGCQEI_R_OFFSET        0x44
+#define SYSCTL_RCGCEEPROM_R_OFFSET     0x58
+#define SYSCTL_RCGCWTIMER_R_OFFSET     0x5C
+
+/*Software Reset .. same sub-offsets as RCGC*/
+#define SYSCTL_SR_OFFSET    0x500
+
+/*Sleep / Deep-Sleep Mode Clock Gating Control .. same sub-offsets as RCGC*/
+#define SYSCTL_SCGC_OFFSET  0x700
+#define SYSCTL_DCGC_OFFSET  0x800
+
+/*Peripheral Ready*/
+#define SYSCTL_PR_OFFSET    0xA00
+
+
+
+#define SYSCTL_RCC_R            (*((volatile unsigned long *)0x400FE060))
+#define SYSCTL_RCC_R_OFFSET     0x060
+#define SYSCTL_RCC_XTAL_M       0x000007C0  // Crystal Value
+#define MOSCDIS 0
+#define USESYSDIV 22
+#define USEPWMDIV 20
+#define PWMDIV_S 17
+#define ACG 27
+#define SYSCTL_RCC_PWMDIV_M     0x000E0000  // PWM Unit Clock Divisor
+
+
+#define SYSCTL_RCC2_R				(*((volatile  unsigned long *)0x400FE070))
+#define SYSCTL_RCC2_R_OFFSET    0x070
+#define PWRDN2 13
+#define BYPASS2 11
+#define DIV400 30
+#define SYSCTL_RCC2_USERCC2     0x80000000  // Use RCC2
+
+#define SYSCTL_RIS_R            (*((volatile  unsigned long*)0x400FE050))
+#define SYSCTL_RIS_R_OFFSET     0x050
+#define PLLLRIS 6
+
+#define MOFRIS 3
+#define MOSCPUPRIS 8
+
+#define SYSCTL_IMC_R_OFFSET     0x054
+#define SYSCTL_MISC_R_OFFSET    0x058
+
+#define SYSCTL_MOSCCTL_R_OFFSET 0x07C
+#define CVAL 0
+#define MOSCIM 1
+#define NOXTAL 2
+
+#define SYSCTL_PLLSTAT_R        (*((volatile  unsigned long *)0x400FE168))
+#define SYSCTL_PLLSTAT_R_OFFSET 0x168
+#define SYSCTL_RESC_R           (*((volatile unsigned long *)0x400FE05C))
+#define SYSCTL_RESC_R_OFFSET    0x05C
+
+#define SYSCTL_ALTCLKCFG_R_OFFSET 0x138
+#define SYSCTL_ALTCLKCFG_ALTCLK_M 0x0000000F  // Alternate Clock Source
+
+#define SYSCTL_PIOSCCAL_R_OFFSET  0x150
+#define SYSCTL_PIOSCCAL_UT_M      0x0000007F  // User Trim Value
+#define UPDATE 8
+#define UTEN 31
+#define SYSCTL_PIOSCSTAT_R_OFFSET 0x154
+#define SYSCTL_PIOSCSTAT_CT_M     0x0000007F  // Calibration Trim Value
+
+#define SYSCTL_DSLPCLKCFG_R_OFFSET 0x144
+#define DSDIVORIDE_S 23
+#define DSOSCSRC_S 4
+#define SYSCTL_DSLPCLKCFG_M     0x1F800070  // Divisor And Clock Source Override
+
+
+/*Peripheral Bit-Band Region*/
+#define PERIPH_BASE             0x40000000
+#define PERIPH_BITBAND_BASE     0x42000000
+
+
+/*Hibernation Module Battery Backed Memory (Reset History Backend)*/
+#define HIB_CTL_R               (*((volatile unsigned long *)0x400FC010))
+#define HIB_CTL_WRC             0x80000000  // Write Complete/Capable
+#define HIB_DATA_R(word)        (*((volatile unsigned long *)(0x400FC030 + ((word) * 4))))
+#define HIB_DATA_WORDS          16
+
+
+/*Data Watchpoint And Trace Cycle Counter*/
+#define CORE_DEMCR_R            (*((volatile unsigned long *)0xE000EDFC))
+#define DEMCR_TRCENA            0x01000000
+#define DWT_CTRL_R              (*((volatile unsigned long *)0xE0001000))
+#define DWT_CTRL_CYCCNTENA      0x00000001
+#define DWT_CYCCNT_R            (*((volatile unsigned long *)0xE0001004))
+
+
+/*System Control Register (Sleep On WFI Selection)*/
+#define CORE_SCR_R              (*((volatile unsigned long *)0xE000ED10))
+#define SCR_SLEEPDEEP           0x00000004
+
+
+/*Register Access Layer .. offsets are relative to SYSCTL_BASE*/
+#if (SYSCTRL_HOST_SIMULATOR == 1U)
+#include "SysCtrl_sim.h"
+#define SYSCTL_REG_READ(offset)                       SysCtrl_simRead(offset)
+#define SYSCTL_REG_WRITE(offset, value)               SysCtrl_simWrite((offset), (value))
+#define SYSCTL_REG_MODIFY(offset, clearMask, setMask) SysCtrl_simModify((offset), (clearMask), (setMask))
+#define SYSCTL_REG_BIT_WRITE(offset, bit, value)      SysCtrl_simBitWrite((offset), (bit), (value))
+#define SYSCTRL_CYCLE_COUNTER_ENABLE()
+#define SYSCTRL_CYCLE_COUNT()                         SysCtrl_simGetCycles()
+#define SYSCTRL_WAIT_FOR_INTERRUPT(deepSleep)         SysCtrl_simWaitForInterrupt(deepSleep)
+#else
+#define SYSCTL_REG(offset)                            (*((volatile unsigned long *)(SYSCTL_BASE + (offset))))
+#define SYSCTL_REG_READ(offset)                       (SYSCTL_REG(offset))
+#define SYSCTL_REG_WRITE(offset, value)               (SYSCTL_REG(offset) = (value))
+#define SYSCTL_REG_MODIFY(offset, clearMask, setMask) (SYSCTL_REG(offset) = (SYSCTL_REG(offset) & ~(clearMask)) | (setMask))
+#define SYSCTL_REG_BITBAND(offset, bit)               (*((volatile unsigned long *)(PERIPH_BITBAND_BASE + \
+                                                          (((SYSCTL_BASE - PERIPH_BASE) + (offset)) * 32) + ((bit) * 4))))
+#define SYSCTL_REG_BIT_WRITE(offset, bit, value)      (SYSCTL_REG_BITBAND((offset), (bit)) = (value))
+#define SYSCTRL_CYCLE_COUNTER_ENABLE()                do { CORE_DEMCR_R |= DEMCR_TRCENA; DWT_CTRL_R |= DWT_CTRL_CYCCNTENA; } while (0)
+#define SYSCTRL_CYCLE_COUNT()                         (DWT_CYCCNT_R)
+#define SYSCTRL_WAIT_FOR_INTERRUPT(deepSleep)         do { if (deepSleep) { CORE_SCR_R |= SCR_SLEEPDEEP; }            \
+                                                           else { CORE_SCR_R &= ~SCR_SLEEPDEEP; }                       \
+                                                           __asm volatile ("dsb\n\twfi" ::: "memory"); } while (0)
+#endif
+
+
+#endif
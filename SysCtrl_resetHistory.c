@@ -0,0 +1,363 @@
+/******************************************************************************
+ *
+ * Module: System Control
+ *
+ * File Name: SysCtrl_resetHistory.c
+ *
+ * Description: Reset History
+ * SysCtrl_resetHistoryInit logs the reset cause once per boot into a ring buffer kept in
+ * no-init RAM or in hibernation memory. The block carries a CRC-16/CCITT and is rebuilt
+ * when it does not match. SysCtrl_resetHistoryTick keeps the uptime and active profile in
+ * no-init RAM so the next boot can tell when, and on which clock, the reset happened.
+ *
+ * Author: Sayed Mohsen
+ *
+ *******************************************************************************/
+#include "SysCtrl.h"
+#include "SysCtrl_map.h"
+#include "SysCtrl_resetHistory.h"
+
+/*Block Signatures*/
+#define RESET_HISTORY_MAGIC     (0x5253U)
+#define RESET_LIVE_MAGIC        (0x4C495645UL)
+
+/*Decoded Causes .. RESC bits 0..5 plus MOSC failure (bit 16) kept as bit 6*/
+#define RESET_CAUSE_KINDS       (7U)
+#define RESET_CAUSE_MOSC_BIT    (6U)
+#define RESET_CAUSE_PACK(cause) ((unsigned char)(((cause) & 0x3FUL) | \
+                                 (((cause) & SYSCTRL_MOSC_FAILURE_RESET) ? (1U << RESET_CAUSE_MOSC_BIT) : 0U)))
+#define RESET_CAUSE_UNPACK(bits) (((SysCtrl_resetCauseType)(bits) & 0x3FUL) | \
+                                  (((bits) & (1U << RESET_CAUSE_MOSC_BIT)) ? SYSCTRL_MOSC_FAILURE_RESET : 0UL))
+
+/**********************************************************************************************************************
+ *  LOCAL DATA TYPES AND STRUCTURES
+ *********************************************************************************************************************/
+
+/*Packed Entry*/
+typedef struct {
+	unsigned short sequence;
+	unsigned char cause;/*RESET_CAUSE_PACK*/
+	unsigned char profile;
+	unsigned long timestamp;
+}SysCtrl_resetRecordType;
+
+/*Persistent Block .. crc covers every field after it, padding left out*/
+typedef struct {
+	unsigned short magic;
+	unsigned short crc;
+	unsigned short nextSequence;
+	unsigned char head;/*Next Entry To Write*/
+	unsigned char count;
+	unsigned short causeCount[RESET_CAUSE_KINDS];
+	SysCtrl_resetRecordType record[SYSCTRL_RESET_HISTORY_DEPTH];
+}SysCtrl_resetHistoryBlockType;
+
+/*Updated Every Tick .. no CRC, only a signature*/
+typedef struct {
+	unsigned long magic;
+	unsigned long uptime;
+	SysCtrl_profileIdType profile;
+}SysCtrl_resetLiveType;
+
+#if (SYSCTRL_RESET_HISTORY_BACKEND == SYSCTRL_RESET_HISTORY_HIBDATA)
+#if (SYSCTRL_HOST_SIMULATOR == 1U)
+#error "SYSCTRL_RESET_HISTORY_HIBDATA needs the hibernation module of the target"
+#endif
+/*Build Fails When The Block Does Not Fit The Hibernation Memory*/
+typedef char SysCtrl_resetHistoryFitsHib[(sizeof(SysCtrl_resetHistoryBlockType) <= (HIB_DATA_WORDS * 4)) ? 1 : -1];
+#endif
+
+/**********************************************************************************************************************
+ *  GLOBAL DATA
+ *********************************************************************************************************************/
+
+/*Working Copy Of The History (Lives In No-Init RAM For The RAM Backend)*/
+static SysCtrl_resetHistoryBlockType g_resetHistory SYSCTRL_NO_INIT;
+
+/*Uptime And Profile Of The Running Boot*/
+static SysCtrl_resetLiveType g_resetLive SYSCTRL_NO_INIT;
+
+/**********************************************************************************************************************
+*  LOCAL FUNCTION
+*********************************************************************************************************************/
+static unsigned short SysCtrl_resetHistoryCrcAdd(unsigned short crc, unsigned long value, unsigned char bytes);
+static unsigned short SysCtrl_resetHistoryCrc(void);
+static void SysCtrl_resetHistoryLoad(void);
+static void SysCtrl_resetHistoryStore(void);
+static void SysCtrl_resetHistoryFormat(void);
+
+
+/******************************************************************************
+* \Syntax          : SysCtrl_returnType SysCtrl_resetHistoryInit(void)
+* \Description     : Log The Cause Of This Reset .. call once per boot, before anything that
+*                    reads the reset cause is expected to have cleared it (SysCtrl_getResetCause latches)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): SYSCTRL_E_OK / SYSCTRL_E_NOT_OK (history was corrupt and has been rebuilt)
+*******************************************************************************/
+SysCtrl_returnType SysCtrl_resetHistoryInit(void)
+{
+	SysCtrl_returnType status = SYSCTRL_E_OK;
+	SysCtrl_resetRecordType *record_ptr;
+	unsigned char cause = RESET_CAUSE_PACK(SysCtrl_getResetCause());
+	unsigned char kind;
+
+	SysCtrl_resetHistoryLoad();
+	if ((g_resetHistory.magic != RESET_HISTORY_MAGIC) || (g_resetHistory.crc != SysCtrl_resetHistoryCrc()) ||
+	    (g_resetHistory.head >= SYSCTRL_RESET_HISTORY_DEPTH) || (g_resetHistory.count > SYSCTRL_RESET_HISTORY_DEPTH))
+	{
+		SysCtrl_resetHistoryFormat();
+		status = SYSCTRL_E_NOT_OK;
+	}
+
+	record_ptr = &g_resetHistory.record[g_resetHistory.head];
+	record_ptr->sequence = g_resetHistory.nextSequence++;
+	record_ptr->cause = cause;
+	if (g_resetLive.magic == RESET_LIVE_MAGIC)
+	{
+		record_ptr->timestamp = g_resetLive.uptime;
+		record_ptr->profile = g_resetLive.profile;
+	}
+	else
+	{
+		record_ptr->timestamp = 0;
+		record_ptr->profile = SYSCTRL_NUM_OF_PROFILES;
+	}
+
+	for (kind = 0; kind < RESET_CAUSE_KINDS; kind++)
+	{
+		if ((cause & (1U << kind)) && (g_resetHistory.causeCount[kind] != 0xFFFF))
+		{
+			g_resetHistory.causeCount[kind]++;
+		}
+	}
+
+	g_resetHistory.head = (unsigned char)((g_resetHistory.head + 1) % SYSCTRL_RESET_HISTORY_DEPTH);
+	if (g_resetHistory.count < SYSCTRL_RESET_HISTORY_DEPTH)
+	{
+		g_resetHistory.count++;
+	}
+	SysCtrl_resetHistoryStore();
+
+	g_resetLive.magic = RESET_LIVE_MAGIC;
+	g_resetLive.uptime = 0;
+	g_resetLive.profile = SysCtrl_getProfile();
+	return status;
+}
+
+/******************************************************************************
+* \Syntax          : void SysCtrl_resetHistoryTick(void)
+* \Description     : Tick Hook .. call from the system tick ISR, keeps uptime and profile for the next boot
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+*******************************************************************************/
+void SysCtrl_resetHistoryTick(void)
+{
+	g_resetLive.uptime++;
+	g_resetLive.profile = SysCtrl_getProfile();
+}
+
+/******************************************************************************
+* \Syntax          : unsigned char SysCtrl_resetHistoryCount(void)
+* \Description     : Number Of Entries In The Reset History
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): entries (at most SYSCTRL_RESET_HISTORY_DEPTH)
+*******************************************************************************/
+unsigned char SysCtrl_resetHistoryCount(void)
+{
+	return g_resetHistory.count;
+}
+
+/******************************************************************************
+* \Syntax          : SysCtrl_returnType SysCtrl_resetHistoryGet(unsigned char age, SysCtrl_resetEntryType *entry_ptr)
+* \Description     : Read One Reset History Entry
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : age -> 0 this boot, 1 the boot before, ...
+* \Parameters (out): entry_ptr -> decoded entry / SYSCTRL_E_OK / SYSCTRL_E_NOT_OK
+*******************************************************************************/
+SysCtrl_returnType SysCtrl_resetHistoryGet(unsigned char age, SysCtrl_resetEntryType *entry_ptr)
+{
+	const SysCtrl_resetRecordType *record_ptr;
+
+	if ((entry_ptr == (void *)0) || (age >= g_resetHistory.count))
+	{
+		return SYSCTRL_E_NOT_OK;
+	}
+
+	record_ptr = &g_resetHistory.record[(g_resetHistory.head + SYSCTRL_RESET_HISTORY_DEPTH - 1 - age) % SYSCTRL_RESET_HISTORY_DEPTH];
+	entry_ptr->sequence = record_ptr->sequence;
+	entry_ptr->cause = RESET_CAUSE_UNPACK(record_ptr->cause);
+	entry_ptr->timestamp = record_ptr->timestamp;
+	entry_ptr->profile = record_ptr->profile;
+	return SYSCTRL_E_OK;
+}
+
+/******************************************************************************
+* \Syntax          : unsigned short SysCtrl_resetHistoryCauseCount(SysCtrl_resetCauseType cause)
+* \Description     : Number Of Logged Resets With A Cause (saturates at 0xFFFF)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : cause -> one SYSCTRL_xxx_RESET value
+* \Parameters (out): count
+*******************************************************************************/
+unsigned short SysCtrl_resetHistoryCauseCount(SysCtrl_resetCauseType cause)
+{
+	unsigned char bits = RESET_CAUSE_PACK(cause);
+	unsigned char kind;
+
+	for (kind = 0; kind < RESET_CAUSE_KINDS; kind++)
+	{
+		if (bits == (1U << kind))
+		{
+			return g_resetHistory.causeCount[kind];
+		}
+	}
+	return 0;
+}
+
+/******************************************************************************
+* \Syntax          : void SysCtrl_resetHistoryClear(void)
+* \Description     : Drop Every Entry And Counter
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+*******************************************************************************/
+void SysCtrl_resetHistoryClear(void)
+{
+	SysCtrl_resetHistoryFormat();
+	SysCtrl_resetHistoryStore();
+}
+
+/******************************************************************************
+* \Syntax          : static unsigned short SysCtrl_resetHistoryCrcAdd(unsigned short crc, unsigned long value,
+*                                                                    unsigned char bytes)
+* \Description     : CRC-16/CCITT (0x1021) Step Over The Low Bytes Of A Field, Least Significant First
+*******************************************************************************/
+static unsigned short SysCtrl_resetHistoryCrcAdd(unsigned short crc, unsigned long value, unsigned char bytes)
+{
+	unsigned char bit;
+
+	for (; bytes != 0; bytes--)
+	{
+		crc ^= (unsigned short)((value & 0xFFUL) << 8);
+		for (bit = 0; bit < 8; bit++)
+		{
+			crc = (crc & 0x8000) ? (unsigned short)((crc << 1) ^ 0x1021) : (unsigned short)(crc << 1);
+		}
+		value >>= 8;
+	}
+	return crc;
+}
+
+/******************************************************************************
+* \Syntax          : static unsigned short SysCtrl_resetHistoryCrc(void)
+* \Description     : CRC-16/CCITT (init 0xFFFF) Over The Fields After crc .. field by field, so the
+*                    padding the compiler puts between them (never written) does not count
+*******************************************************************************/
+static unsigned short SysCtrl_resetHistoryCrc(void)
+{
+	const SysCtrl_resetRecordType *record_ptr;
+	unsigned short crc = 0xFFFF;
+	unsigned char index;
+
+	crc = SysCtrl_resetHistoryCrcAdd(crc, g_resetHistory.nextSequence, 2);
+	crc = SysCtrl_resetHistoryCrcAdd(crc, g_resetHistory.head, 1);
+	crc = SysCtrl_resetHistoryCrcAdd(crc, g_resetHistory.count, 1);
+	for (index = 0; index < RESET_CAUSE_KINDS; index++)
+	{
+		crc = SysCtrl_resetHistoryCrcAdd(crc, g_resetHistory.causeCount[index], 2);
+	}
+	for (index = 0; index < SYSCTRL_RESET_HISTORY_DEPTH; index++)
+	{
+		record_ptr = &g_resetHistory.record[index];
+		crc = SysCtrl_resetHistoryCrcAdd(crc, record_ptr->sequence, 2);
+		crc = SysCtrl_resetHistoryCrcAdd(crc, record_ptr->cause, 1);
+		crc = SysCtrl_resetHistoryCrcAdd(crc, record_ptr->profile, 1);
+		crc = SysCtrl_resetHistoryCrcAdd(crc, record_ptr->timestamp, 4);
+	}
+	return crc;
+}
+
+/******************************************************************************
+* \Syntax          : static void SysCtrl_resetHistoryFormat(void)
+* \Description     : Empty History
+*******************************************************************************/
+static void SysCtrl_resetHistoryFormat(void)
+{
+	unsigned char *data_ptr = (unsigned char *)&g_resetHistory;
+	unsigned long index;
+
+	for (index = 0; index < sizeof(g_resetHistory); index++)
+	{
+		data_ptr[index] = 0;
+	}
+	g_resetHistory.magic = RESET_HISTORY_MAGIC;
+}
+
+#if (SYSCTRL_RESET_HISTORY_BACKEND == SYSCTRL_RESET_HISTORY_HIBDATA)
+/******************************************************************************
+* \Syntax          : static void SysCtrl_resetHistoryLoad(void)
+* \Description     : Copy The Block Out Of Hibernation Memory (opens the HIB gate)
+*******************************************************************************/
+static void SysCtrl_resetHistoryLoad(void)
+{
+	unsigned long *word_ptr = (unsigned long *)&g_resetHistory;
+	SysCtrl_periphralSetType hib = {{0}};
+	unsigned char word;
+
+	SYSCTRL_PERIPHRAL_SET_ADD(hib, SYSCTL_CHIB, 0);
+	(void)SysCtrl_peripheralEnableSet(&hib);
+
+	for (word = 0; word < ((sizeof(g_resetHistory) + 3) / 4); word++)
+	{
+		word_ptr[word] = HIB_DATA_R(word);
+	}
+}
+
+/******************************************************************************
+* \Syntax          : static void SysCtrl_resetHistoryStore(void)
+* \Description     : Write The Block Back To Hibernation Memory
+*******************************************************************************/
+static void SysCtrl_resetHistoryStore(void)
+{
+	const unsigned long *word_ptr = (const unsigned long *)&g_resetHistory;
+	unsigned char word;
+
+	g_resetHistory.crc = SysCtrl_resetHistoryCrc();
+	for (word = 0; word < ((sizeof(g_resetHistory) + 3) / 4); word++)
+	{
+		while ((HIB_CTL_R & HIB_CTL_WRC) == 0)
+		{
+		}
+		HIB_DATA_R(word) = word_ptr[word];
+	}
+}
+#else
+/******************************************************************************
+* \Syntax          : static void SysCtrl_resetHistoryLoad(void)
+* \Description     : No-Init RAM Backend .. the working copy is the stored block
+*******************************************************************************/
+static void SysCtrl_resetHistoryLoad(void)
+{
+}
+
+/******************************************************************************
+* \Syntax          : static void SysCtrl_resetHistoryStore(void)
+* \Description     : No-Init RAM Backend .. seal the block
+*******************************************************************************/
+static void SysCtrl_resetHistoryStore(void)
+{
+	g_resetHistory.crc = SysCtrl_resetHistoryCrc();
+}
+#endif
+
+/**********************************************************************************************************************
+ *  END OF FILE: SysCtrl_resetHistory.c
+ *********************************************************************************************************************/
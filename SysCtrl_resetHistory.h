@@ -0,0 +1,47 @@
+/******************************************************************************
+ *
+ * Module: System Control
+ *
+ * File Name: SysCtrl_resetHistory.h
+ *
+ * Description: Header File For The Reset History
+ * Keeps a CRC protected ring buffer of reset causes across resets, each entry with a
+ * sequence number, the uptime and the clock profile active when the reset happened.
+ *
+ * Author: Sayed Mohsen
+ *
+ *******************************************************************************/
+#ifndef SYSCTRL_RESETHISTORY_H
+#define SYSCTRL_RESETHISTORY_H
+
+/**********************************************************************************************************************
+ * INCLUDES
+ *********************************************************************************************************************/
+#include "SysCtrl.h"
+
+/**********************************************************************************************************************
+ *  GLOBAL DATA TYPES AND STRUCTURES
+ *********************************************************************************************************************/
+
+/*Reset History Entry*/
+typedef struct {
+	unsigned short sequence;/*Increments On Every Logged Reset*/
+	SysCtrl_resetCauseType cause;/*SYSCTRL_xxx_RESET Bits*/
+	unsigned long timestamp;/*SysCtrl_resetHistoryTick Ticks Since The Previous Boot (0 -> Unknown)*/
+	SysCtrl_profileIdType profile;/*Profile Active Before Reset (SYSCTRL_NUM_OF_PROFILES -> None)*/
+}SysCtrl_resetEntryType;
+
+/**********************************************************************************************************************
+ *  GLOBAL FUNCTION PROTOTYPES
+ *********************************************************************************************************************/
+SysCtrl_returnType SysCtrl_resetHistoryInit(void);
+void SysCtrl_resetHistoryTick(void);
+unsigned char SysCtrl_resetHistoryCount(void);
+SysCtrl_returnType SysCtrl_resetHistoryGet(unsigned char age, SysCtrl_resetEntryType *entry_ptr);
+unsigned short SysCtrl_resetHistoryCauseCount(SysCtrl_resetCauseType cause);
+void SysCtrl_resetHistoryClear(void);
+#endif  /* SYSCTRL_RESETHISTORY_H */
+
+/**********************************************************************************************************************
+ *  END OF FILE: SysCtrl_resetHistory.h
+ *********************************************************************************************************************/
@@ -0,0 +1,682 @@
+/******************************************************************************
+ *
+ * Module: System Control
+ *
+ * File Name: SysCtrl_sim.c
+ *
+ * Description: Host Side SYSCTL Simulator
+ * Replaces the memory mapped SYSCTL block when SYSCTRL_HOST_SIMULATOR is 1 so the driver
+ * can run and be measured off-target. Time advances by one step on every register access.
+ *
+ * Author: Sayed Mohsen
+ *
+ *******************************************************************************/
+#include "SysCtrl.h"
+#include "SysCtrl_map.h"
+
+#if (SYSCTRL_HOST_SIMULATOR == 1U)
+
+/*Simulated Register Block Size In Words (0x400FE000 - 0x400FEFFF)*/
+#define SIM_REGISTER_WORDS   (0x1000 / 4)
+
+/*Power On Reset Values*/
+#define SIM_RCC_RESET_VALUE  (0x078E3AD1UL)
+#define SIM_RCC2_RESET_VALUE (0x07C06810UL)
+#define SIM_DSLPCLKCFG_RESET_VALUE (0x07800000UL)
+
+/*Simulated Register Bits*/
+#define SIM_RCC_PWRDN        13
+#define SIM_RCC_BYPASS       11
+#define SIM_RCC_USESYSDIV    22
+#define SIM_RCC_XTAL_SHIFT   6
+#define SIM_RCC_MOSCDIS      0
+#define SIM_RIS_MOSCPUPRIS   8
+
+/*PIOSC Model .. factory trim in PIOSCSTAT CT, each user trim step away from it moves PIOSC by SIM_PIOSC_TRIM_STEP_PPM*/
+#define SIM_PIOSC_HZ         (16000000L)
+#define SIM_PIOSC_FACTORY_TRIM (0x40UL)
+#define SIM_PIOSC_TRIM_STEP_PPM (1500L)
+
+#define SIM_REG(offset)      (g_simRegisters[(offset) >> 2])
+
+/*Software Reset, Run Mode Gate And Peripheral Ready Blocks Span The Same Offsets*/
+#define SIM_GATE_BLOCK_SIZE  (0x60)
+#define SIM_IS_SR(offset)    (((offset) >= SYSCTL_SR_OFFSET) && ((offset) < (SYSCTL_SR_OFFSET + SIM_GATE_BLOCK_SIZE)))
+#define SIM_IS_RCGC(offset)  (((offset) >= SYSCTL_RCGC_OFFSET) && ((offset) < (SYSCTL_RCGC_OFFSET + SIM_GATE_BLOCK_SIZE)))
+#define SIM_IS_PR(offset)    (((offset) >= SYSCTL_PR_OFFSET) && ((offset) < (SYSCTL_PR_OFFSET + SIM_GATE_BLOCK_SIZE)))
+
+/**********************************************************************************************************************
+ *  GLOBAL DATA
+ *********************************************************************************************************************/
+
+/*Simulated SYSCTL Register Block*/
+static unsigned long g_simRegisters[SIM_REGISTER_WORDS];
+
+/*Access Counters*/
+static SysCtrl_simAccessCountType g_simAccessCount;
+
+/*Simulated Time .. one step per register access*/
+static unsigned long g_simCycles;
+
+/*PLL Lock Model*/
+static unsigned long g_simPllLockDelay = SYSCTRL_SIM_PLL_LOCK_ACCESSES;
+static unsigned long g_simPllLockCountdown;
+static unsigned char g_simPllPowered;
+static unsigned long g_simPllXtal;
+
+/*Crystal Attached And Oscillating (MOSC Power Up Model)*/
+static unsigned char g_simMoscPresent = 1;
+
+/*PIOSC Drift Away From 16 MHz (ppm) And Applied User Trim*/
+static long g_simPioscDriftPpm;
+static unsigned long g_simPioscTrim = SIM_PIOSC_FACTORY_TRIM;
+
+/*Peripheral Ready Model*/
+static unsigned long g_simReadyCountdown;
+
+/*WFI Count .. index 0 sleep, 1 deep-sleep*/
+static unsigned long g_simSleepCount[2];
+
+/*Crystal Frequencies Indexed By RCC XTAL Field*/
+static const SysCtrl_systemClock g_simXtalClock[0x20] =
+{
+	0, 0, 0, 0, 0, 0,
+	4000000UL, 4096000UL, 4915200UL, 5000000UL, 5120000UL, 6000000UL, 6144000UL,
+	7372800UL, 8000000UL, 8192000UL, 10000000UL, 12000000UL, 12288000UL, 13560000UL,
+	14318180UL, 16000000UL, 16384000UL, 18000000UL, 20000000UL, 24000000UL, 25000000UL
+};
+
+/**********************************************************************************************************************
+*  LOCAL FUNCTION
+*********************************************************************************************************************/
+static void SysCtrl_simTick(void);
+static void SysCtrl_simUpdatePll(void);
+static void SysCtrl_simStore(unsigned long offset, unsigned long value);
+static SysCtrl_systemClock SysCtrl_simPioscClock(void);
+
+
+/******************************************************************************
+* \Syntax          : void SysCtrl_simReset(void)
+* \Description     : Load Power On Reset Values And Clear Access Counters
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+*******************************************************************************/
+void SysCtrl_simReset(void)
+{
+	unsigned long index;
+
+	for (index = 0; index < SIM_REGISTER_WORDS; index++)
+	{
+		g_simRegisters[index] = 0;
+	}
+
+	SIM_REG(SYSCTL_RCC_R_OFFSET) = SIM_RCC_RESET_VALUE;
+	SIM_REG(SYSCTL_RCC2_R_OFFSET) = SIM_RCC2_RESET_VALUE;
+	SIM_REG(SYSCTL_DSLPCLKCFG_R_OFFSET) = SIM_DSLPCLKCFG_RESET_VALUE;
+	SIM_REG(SYSCTL_PIOSCSTAT_R_OFFSET) = SIM_PIOSC_FACTORY_TRIM;
+
+	g_simPllLockCountdown = 0;
+	g_simPllPowered = 0;
+	g_simPllXtal = 0;
+	g_simReadyCountdown = 0;
+	g_simSleepCount[0] = 0;
+	g_simSleepCount[1] = 0;
+	g_simMoscPresent = 1;
+	g_simPioscDriftPpm = 0;
+	g_simPioscTrim = SIM_PIOSC_FACTORY_TRIM;
+
+	SysCtrl_simClearAccessCount();
+}
+
+/******************************************************************************
+* \Syntax          : unsigned long SysCtrl_simRead(unsigned long offset)
+* \Description     : Counted Register Read
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : offset -> register offset from SYSCTL_BASE
+* \Parameters (out): register value
+*******************************************************************************/
+unsigned long SysCtrl_simRead(unsigned long offset)
+{
+	g_simAccessCount.reads++;
+	g_simAccessCount.busAccesses++;
+	SysCtrl_simTick();
+	return SysCtrl_simPeek(offset);
+}
+
+/******************************************************************************
+* \Syntax          : void SysCtrl_simWrite(unsigned long offset, unsigned long value)
+* \Description     : Counted Register Write
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : offset -> register offset from SYSCTL_BASE
+*                  : value -> value to write
+* \Parameters (out): None
+*******************************************************************************/
+void SysCtrl_simWrite(unsigned long offset, unsigned long value)
+{
+	g_simAccessCount.writes++;
+	g_simAccessCount.busAccesses++;
+	SysCtrl_simTick();
+	SysCtrl_simStore(offset, value);
+}
+
+/******************************************************************************
+* \Syntax          : void SysCtrl_simModify(unsigned long offset, unsigned long clearMask, unsigned long setMask)
+* \Description     : Counted Read-Modify-Write (one read and one write on the bus)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : offset -> register offset from SYSCTL_BASE
+*                  : clearMask -> bits to clear / setMask -> bits to set
+* \Parameters (out): None
+*******************************************************************************/
+void SysCtrl_simModify(unsigned long offset, unsigned long clearMask, unsigned long setMask)
+{
+	unsigned long value;
+
+	g_simAccessCount.readModifyWrites++;
+	g_simAccessCount.busAccesses += 2;
+	SysCtrl_simTick();
+	value = SysCtrl_simPeek(offset);
+	SysCtrl_simTick();
+	SysCtrl_simStore(offset, (value & ~clearMask) | setMask);
+}
+
+/******************************************************************************
+* \Syntax          : void SysCtrl_simBitWrite(unsigned long offset, unsigned char bit, unsigned long value)
+* \Description     : Counted Bit-Band Alias Store .. one write on the bus, no read
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : offset -> register offset from SYSCTL_BASE
+*                  : bit -> bit number / value -> bit 0 of value is stored
+* \Parameters (out): None
+*******************************************************************************/
+void SysCtrl_simBitWrite(unsigned long offset, unsigned char bit, unsigned long value)
+{
+	unsigned long current = SysCtrl_simPeek(offset);
+
+	g_simAccessCount.writes++;
+	g_simAccessCount.busAccesses++;
+	SysCtrl_simTick();
+	if (value & 1)
+	{
+		SysCtrl_simStore(offset, current | (1UL << bit));
+	}
+	else
+	{
+		SysCtrl_simStore(offset, current & ~(1UL << bit));
+	}
+}
+
+/******************************************************************************
+* \Syntax          : unsigned long SysCtrl_simPeek(unsigned long offset)
+* \Description     : Uncounted Register Read For Inspection
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : offset -> register offset from SYSCTL_BASE
+* \Parameters (out): register value
+*******************************************************************************/
+unsigned long SysCtrl_simPeek(unsigned long offset)
+{
+	if (offset == SYSCTL_MISC_R_OFFSET)
+	{
+		/*Masked Interrupt Status*/
+		return SIM_REG(SYSCTL_RIS_R_OFFSET) & SIM_REG(SYSCTL_IMC_R_OFFSET);
+	}
+	return SIM_REG(offset & 0xFFC) & 0xFFFFFFFFUL;
+}
+
+/******************************************************************************
+* \Syntax          : void SysCtrl_simSetResetCause(unsigned long cause)
+* \Description     : Latch A Reset Cause In RESC
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : cause -> SYSCTRL_xxx_RESET bits
+* \Parameters (out): None
+*******************************************************************************/
+void SysCtrl_simSetResetCause(unsigned long cause)
+{
+	SIM_REG(SYSCTL_RESC_R_OFFSET) |= cause;
+}
+
+/******************************************************************************
+* \Syntax          : void SysCtrl_simSetPllLockDelay(unsigned long accesses)
+* \Description     : Set Number Of Register Accesses The PLL Needs To Lock
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : accesses -> lock delay
+* \Parameters (out): None
+*******************************************************************************/
+void SysCtrl_simSetPllLockDelay(unsigned long accesses)
+{
+	g_simPllLockDelay = accesses;
+}
+
+/******************************************************************************
+* \Syntax          : void SysCtrl_simGetAccessCount(SysCtrl_simAccessCountType *count_ptr)
+* \Description     : Get Register Access Counters Since Last Clear
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): count_ptr -> access counters
+*******************************************************************************/
+void SysCtrl_simGetAccessCount(SysCtrl_simAccessCountType *count_ptr)
+{
+	if (count_ptr != (void *)0)
+	{
+		*count_ptr = g_simAccessCount;
+	}
+}
+
+/******************************************************************************
+* \Syntax          : void SysCtrl_simClearAccessCount(void)
+* \Description     : Clear Register Access Counters
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+*******************************************************************************/
+void SysCtrl_simClearAccessCount(void)
+{
+	g_simAccessCount.reads = 0;
+	g_simAccessCount.writes = 0;
+	g_simAccessCount.readModifyWrites = 0;
+	g_simAccessCount.busAccesses = 0;
+}
+
+/******************************************************************************
+* \Syntax          : SysCtrl_systemClock SysCtrl_simGetSystemClock(void)
+* \Description     : Decode The System Clock Produced By Current RCC/RCC2 Contents .. PIOSC drift and
+*                    trim carry through to PIOSC derived clocks
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): system clock in Hz (0 -> PLL selected but not locked)
+*******************************************************************************/
+SysCtrl_systemClock SysCtrl_simGetSystemClock(void)
+{
+	unsigned long rcc = SIM_REG(SYSCTL_RCC_R_OFFSET);
+	unsigned long rcc2 = SIM_REG(SYSCTL_RCC2_R_OFFSET);
+	unsigned long useRcc2 = ((rcc2 & SYSCTL_RCC2_USERCC2) != 0);
+	unsigned long oscSource;
+	unsigned long bypass;
+	unsigned long divisor;
+	SysCtrl_systemClock oscClock;
+	SysCtrl_systemClock pllClock;
+
+	if (useRcc2)
+	{
+		oscSource = (rcc2 >> 4) & 0x7;
+		bypass = (rcc2 >> BYPASS2) & 1;
+		divisor = ((rcc2 >> 23) & 0x3F) + 1;
+	}
+	else
+	{
+		oscSource = (rcc >> 4) & 0x3;
+		bypass = (rcc >> SIM_RCC_BYPASS) & 1;
+		divisor = ((rcc >> 23) & 0xF) + 1;
+	}
+
+	if (!bypass)
+	{
+		if (SIM_REG(SYSCTL_PLLSTAT_R_OFFSET) == 0)
+		{
+			return 0;
+		}
+		if (useRcc2 && ((rcc2 >> DIV400) & 1))
+		{
+			pllClock = 400000000UL / (((rcc2 >> 22) & 0x7F) + 1);
+		}
+		else
+		{
+			pllClock = 200000000UL / divisor;
+		}
+		if (oscSource == CLOCK_SOURCE_PRECISION_INTERNAL_OSCILLATOR)
+		{
+			/*The PLL Follows Its PIOSC Reference*/
+			pllClock = (SysCtrl_systemClock)(((unsigned long long)pllClock * SysCtrl_simPioscClock()) / SIM_PIOSC_HZ);
+		}
+		return pllClock;
+	}
+
+	switch (oscSource)
+	{
+	case CLOCK_SOURCE_MAIN_OSCILLATOR:
+		oscClock = g_simXtalClock[(rcc & SYSCTL_RCC_XTAL_M) >> SIM_RCC_XTAL_SHIFT];
+		break;
+	case CLOCK_SOURCE_PRECISION_INTERNAL_OSCILLATOR:
+		oscClock = SysCtrl_simPioscClock();
+		break;
+	case CLOCK_SOURCE_PRECISION_INTERNAL_OSCILLATOR_DIVDED_4:
+		oscClock = SysCtrl_simPioscClock() / 4;
+		break;
+	case CLOCK_SOURCE_LOW_FREQUENCY_INTERNAL_OSCILLATOR:
+		oscClock = 30000UL;
+		break;
+	case CLOCK_SOURCE_HIBERNTION_OSCILLATOR:
+		oscClock = 32768UL;
+		break;
+	default:
+		oscClock = 0;
+		break;
+	}
+
+	if ((rcc >> SIM_RCC_USESYSDIV) & 1)
+	{
+		oscClock /= divisor;
+	}
+	return oscClock;
+}
+
+/******************************************************************************
+* \Syntax          : unsigned long SysCtrl_simGetCycles(void)
+* \Description     : Simulated Cycle Counter (stands in for DWT CYCCNT)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): register accesses since start
+*******************************************************************************/
+unsigned long SysCtrl_simGetCycles(void)
+{
+	return g_simCycles;
+}
+
+/******************************************************************************
+* \Syntax          : void SysCtrl_simWaitForInterrupt(unsigned char deepSleep)
+* \Description     : Stands In For WFI .. the wake interrupt is taken at once. The PLL is powered
+*                    down in deep-sleep and starts relocking on wake.
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : deepSleep -> 0 sleep, 1 deep-sleep
+* \Parameters (out): None
+*******************************************************************************/
+void SysCtrl_simWaitForInterrupt(unsigned char deepSleep)
+{
+	deepSleep = (deepSleep != 0);
+	g_simSleepCount[deepSleep]++;
+
+	if (deepSleep && g_simPllPowered)
+	{
+		SIM_REG(SYSCTL_PLLSTAT_R_OFFSET) = 0;
+		g_simPllLockCountdown = (g_simPllLockDelay == 0) ? 1 : g_simPllLockDelay;
+	}
+}
+
+/******************************************************************************
+* \Syntax          : void SysCtrl_simFailMosc(void)
+* \Description     : Main Oscillator Stops .. with MOSCCTL CVAL set the failure raises MOFRIS
+*                    (MOSCIM set) or is recorded as a MOSC failure reset in RESC
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+*******************************************************************************/
+void SysCtrl_simFailMosc(void)
+{
+	unsigned long moscctl = SIM_REG(SYSCTL_MOSCCTL_R_OFFSET);
+
+	if (moscctl & (1 << CVAL))
+	{
+		if (moscctl & (1 << MOSCIM))
+		{
+			SIM_REG(SYSCTL_RIS_R_OFFSET) |= (1 << MOFRIS);
+		}
+		else
+		{
+			SIM_REG(SYSCTL_RESC_R_OFFSET) |= SYSCTRL_MOSC_FAILURE_RESET;
+		}
+	}
+}
+
+/******************************************************************************
+* \Syntax          : unsigned long SysCtrl_simGetSleepCount(unsigned char deepSleep)
+* \Description     : Number Of Sleep Or Deep-Sleep Entries Since SysCtrl_simReset
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : deepSleep -> 0 sleep, 1 deep-sleep
+* \Parameters (out): entry count
+*******************************************************************************/
+unsigned long SysCtrl_simGetSleepCount(unsigned char deepSleep)
+{
+	return g_simSleepCount[deepSleep != 0];
+}
+
+/******************************************************************************
+* \Syntax          : void SysCtrl_simSetMoscPresent(unsigned char present)
+* \Description     : Attach Or Remove The Crystal .. without one MOSCPUPRIS never sets
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : present -> 1 crystal oscillates, 0 no crystal
+* \Parameters (out): None
+*******************************************************************************/
+void SysCtrl_simSetMoscPresent(unsigned char present)
+{
+	g_simMoscPresent = present;
+}
+
+/******************************************************************************
+* \Syntax          : void SysCtrl_simCaptureImage(SysCtrl_simImageType *image_ptr)
+* \Description     : Snapshot Of The Clock Registers, Decoded Clock And Access Counters .. one golden
+*                    record per configuration for host conformance runs
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): image_ptr -> captured image
+*******************************************************************************/
+void SysCtrl_simCaptureImage(SysCtrl_simImageType *image_ptr)
+{
+	if (image_ptr != (void *)0)
+	{
+		image_ptr->rcc = SIM_REG(SYSCTL_RCC_R_OFFSET);
+		image_ptr->rcc2 = SIM_REG(SYSCTL_RCC2_R_OFFSET);
+		image_ptr->systemClock = SysCtrl_simGetSystemClock();
+		image_ptr->access = g_simAccessCount;
+	}
+}
+
+/******************************************************************************
+* \Syntax          : void SysCtrl_simSetPioscDrift(long ppm)
+* \Description     : Detune PIOSC (temperature drift) .. the user trim in PIOSCCAL still applies on top
+* \Sync\Async      : Synchronous
+* \Reentrancy      : non Reentrant
+* \Parameters (in) : ppm -> drift in parts per million (negative -> slower)
+* \Parameters (out): None
+*******************************************************************************/
+void SysCtrl_simSetPioscDrift(long ppm)
+{
+	g_simPioscDriftPpm = ppm;
+}
+
+/******************************************************************************
+* \Syntax          : unsigned long SysCtrl_simMeasureClock(unsigned long periods)
+* \Description     : Stands In For A Timer Edge-Time Capture On The 32.768-kHz Hibernation Clock ..
+*                    a SysCtrl_clockMeasureCallbackType with referenceClock SYSCTRL_XTAL32K_HZ
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : periods -> reference periods to count over
+* \Parameters (out): real system clock cycles in that time
+*******************************************************************************/
+unsigned long SysCtrl_simMeasureClock(unsigned long periods)
+{
+	return (unsigned long)(((unsigned long long)SysCtrl_simGetSystemClock() * periods) / 32768UL);
+}
+
+/******************************************************************************
+* \Syntax          : static SysCtrl_systemClock SysCtrl_simPioscClock(void)
+* \Description     : Real PIOSC Frequency From Drift And Active Trim (factory CT or user UT)
+*******************************************************************************/
+static SysCtrl_systemClock SysCtrl_simPioscClock(void)
+{
+	unsigned long trim = SIM_PIOSC_FACTORY_TRIM;
+	long ppm;
+
+	if (SIM_REG(SYSCTL_PIOSCCAL_R_OFFSET) & (1UL << UTEN))
+	{
+		trim = g_simPioscTrim;
+	}
+	ppm = g_simPioscDriftPpm + (((long)trim - (long)SIM_PIOSC_FACTORY_TRIM) * SIM_PIOSC_TRIM_STEP_PPM);
+	return (SysCtrl_systemClock)(SIM_PIOSC_HZ + ((SIM_PIOSC_HZ / 1000000L) * ppm));
+}
+
+/******************************************************************************
+* \Syntax          : static void SysCtrl_simTick(void)
+* \Description     : Advance Simulated Time By One Register Access
+*******************************************************************************/
+static void SysCtrl_simTick(void)
+{
+	unsigned long offset;
+
+	g_simCycles++;
+
+	if (g_simReadyCountdown != 0)
+	{
+		g_simReadyCountdown--;
+		if (g_simReadyCountdown == 0)
+		{
+			/*Peripheral Ready Follows Run Mode Gate, Instances Held In Reset Stay Not Ready*/
+			for (offset = 0; offset < SIM_GATE_BLOCK_SIZE; offset += 4)
+			{
+				SIM_REG(SYSCTL_PR_OFFSET + offset) = SIM_REG(SYSCTL_RCGC_OFFSET + offset) & ~SIM_REG(SYSCTL_SR_OFFSET + offset);
+			}
+		}
+	}
+
+	if (g_simPllLockCountdown != 0)
+	{
+		g_simPllLockCountdown--;
+		if (g_simPllLockCountdown == 0)
+		{
+			SIM_REG(SYSCTL_PLLSTAT_R_OFFSET) = 1;
+			SIM_REG(SYSCTL_RIS_R_OFFSET) |= (1 << PLLLRIS);
+		}
+	}
+}
+
+/******************************************************************************
+* \Syntax          : static void SysCtrl_simUpdatePll(void)
+* \Description     : Restart PLL Lock When It Is Powered Up Or Its Input Crystal Changes
+*******************************************************************************/
+static void SysCtrl_simUpdatePll(void)
+{
+	unsigned long rcc = SIM_REG(SYSCTL_RCC_R_OFFSET);
+	unsigned long rcc2 = SIM_REG(SYSCTL_RCC2_R_OFFSET);
+	unsigned long xtal = rcc & SYSCTL_RCC_XTAL_M;
+	unsigned char powered;
+	unsigned char reference;
+
+	if (rcc2 & SYSCTL_RCC2_USERCC2)
+	{
+		powered = ((rcc2 & (1 << PWRDN2)) == 0);
+		reference = (((rcc2 >> 4) & 0x7) != CLOCK_SOURCE_MAIN_OSCILLATOR);
+	}
+	else
+	{
+		powered = ((rcc & (1 << SIM_RCC_PWRDN)) == 0);
+		reference = (((rcc >> 4) & 0x3) != CLOCK_SOURCE_MAIN_OSCILLATOR);
+	}
+
+	/*PIOSC Always Works As Reference, A Crystal Only When Present And At Least 5 MHz*/
+	if (!reference)
+	{
+		reference = g_simMoscPresent && (g_simXtalClock[xtal >> SIM_RCC_XTAL_SHIFT] >= 5000000UL);
+	}
+
+	if (powered && !reference)
+	{
+		/*No Usable Reference .. never locks*/
+		SIM_REG(SYSCTL_PLLSTAT_R_OFFSET) = 0;
+		g_simPllLockCountdown = 0;
+	}
+	else if (powered && ((!g_simPllPowered) || (xtal != g_simPllXtal)))
+	{
+		/*Relock .. a stale PLLLRIS stays set until cleared through MISC*/
+		SIM_REG(SYSCTL_PLLSTAT_R_OFFSET) = 0;
+		g_simPllLockCountdown = (g_simPllLockDelay == 0) ? 1 : g_simPllLockDelay;
+	}
+	else if (!powered)
+	{
+		SIM_REG(SYSCTL_PLLSTAT_R_OFFSET) = 0;
+		g_simPllLockCountdown = 0;
+	}
+
+	g_simPllPowered = powered;
+	g_simPllXtal = xtal;
+}
+
+/******************************************************************************
+* \Syntax          : static void SysCtrl_simStore(unsigned long offset, unsigned long value)
+* \Description     : Apply Register Write Semantics
+*******************************************************************************/
+static void SysCtrl_simStore(unsigned long offset, unsigned long value)
+{
+	value &= 0xFFFFFFFFUL;
+
+	switch (offset)
+	{
+	case SYSCTL_RIS_R_OFFSET:
+	case SYSCTL_PLLSTAT_R_OFFSET:
+	case SYSCTL_PIOSCSTAT_R_OFFSET:
+		/*Read Only*/
+		break;
+	case SYSCTL_PIOSCCAL_R_OFFSET:
+		/*UPDATE Loads The User Trim And Clears Itself*/
+		if (value & (1UL << UPDATE))
+		{
+			g_simPioscTrim = value & SYSCTL_PIOSCCAL_UT_M;
+		}
+		SIM_REG(offset) = value & ~(1UL << UPDATE);
+		break;
+	case SYSCTL_MISC_R_OFFSET:
+		/*Write 1 To Clear Raw Interrupt Status*/
+		SIM_REG(SYSCTL_RIS_R_OFFSET) &= ~value;
+		break;
+	case SYSCTL_RESC_R_OFFSET:
+		/*Writing a 0 to any reset cause clears it*/
+		SIM_REG(SYSCTL_RESC_R_OFFSET) &= value;
+		break;
+	case SYSCTL_RCC_R_OFFSET:
+	case SYSCTL_RCC2_R_OFFSET:
+		/*A Present Crystal Reports Power Up As Soon As MOSCDIS Is Cleared*/
+		if ((offset == SYSCTL_RCC_R_OFFSET) && g_simMoscPresent &&
+		    ((SIM_REG(offset) >> SIM_RCC_MOSCDIS) & 1) && !((value >> SIM_RCC_MOSCDIS) & 1))
+		{
+			SIM_REG(SYSCTL_RIS_R_OFFSET) |= (1UL << SIM_RIS_MOSCPUPRIS);
+		}
+		SIM_REG(offset) = value;
+		SysCtrl_simUpdatePll();
+		break;
+	default:
+		if (SIM_IS_PR(offset))
+		{
+			/*Read Only*/
+			break;
+		}
+		if (SIM_IS_SR(offset))
+		{
+			/*Instances In Reset Drop Ready At Once, Released Ones Get Ready Later*/
+			SIM_REG(SYSCTL_PR_OFFSET + (offset - SYSCTL_SR_OFFSET)) &= ~value;
+			if (SIM_REG(offset) & ~value)
+			{
+				g_simReadyCountdown = SYSCTRL_SIM_PERIPHERAL_READY_ACCESSES + 1;
+			}
+		}
+		if (SIM_IS_RCGC(offset))
+		{
+			/*Gated Peripherals Drop Ready At Once, Newly Enabled Ones Get Ready Later*/
+			SIM_REG(SYSCTL_PR_OFFSET + (offset - SYSCTL_RCGC_OFFSET)) &= value;
+			if (value & ~SIM_REG(offset))
+			{
+				g_simReadyCountdown = SYSCTRL_SIM_PERIPHERAL_READY_ACCESSES + 1;
+			}
+		}
+		SIM_REG(offset & 0xFFC) = value;
+		break;
+	}
+}
+
+#endif /* SYSCTRL_HOST_SIMULATOR */
+/**********************************************************************************************************************
+ *  END OF FILE: SysCtrl_sim.c
+ *********************************************************************************************************************/
@@ -0,0 +1,68 @@
+/******************************************************************************
+ *
+ * Module: System Control
+ *
+ * File Name: SysCtrl_sim.h
+ *
+ * Description: Header File For Host Side SYSCTL Simulator
+ * Models RCC/RCC2, PLL lock timing in RIS/PLLSTAT, RESC, the SRx/RCGCx/PRx registers,
+ * sleep / deep-sleep entry, main oscillator failure and PIOSC drift / trim, and counts every register access done by the driver.
+ *
+ * Author: Sayed Mohsen
+ *
+ *******************************************************************************/
+#ifndef SYSCTRL_SIM_H
+#define SYSCTRL_SIM_H
+
+/**********************************************************************************************************************
+ * INCLUDES
+ *********************************************************************************************************************/
+#include "SysCtrl.h"
+
+/**********************************************************************************************************************
+ *  GLOBAL DATA TYPES AND STRUCTURES
+ *********************************************************************************************************************/
+
+/*Register Access Counters*/
+typedef struct {
+	unsigned long reads;
+	unsigned long writes;
+	unsigned long readModifyWrites;
+	unsigned long busAccesses;/*Bus Transfers .. a read-modify-write costs two*/
+}SysCtrl_simAccessCountType;
+
+/*Golden Image Of One Clock Configuration*/
+typedef struct {
+	unsigned long rcc;
+	unsigned long rcc2;
+	SysCtrl_systemClock systemClock;/*Decoded From rcc / rcc2*/
+	SysCtrl_simAccessCountType access;
+}SysCtrl_simImageType;
+
+/**********************************************************************************************************************
+ *  GLOBAL FUNCTION PROTOTYPES
+ *********************************************************************************************************************/
+void SysCtrl_simReset(void);
+unsigned long SysCtrl_simRead(unsigned long offset);
+void SysCtrl_simWrite(unsigned long offset, unsigned long value);
+void SysCtrl_simModify(unsigned long offset, unsigned long clearMask, unsigned long setMask);
+void SysCtrl_simBitWrite(unsigned long offset, unsigned char bit, unsigned long value);
+unsigned long SysCtrl_simPeek(unsigned long offset);
+void SysCtrl_simSetResetCause(unsigned long cause);
+void SysCtrl_simSetPllLockDelay(unsigned long accesses);
+void SysCtrl_simGetAccessCount(SysCtrl_simAccessCountType *count_ptr);
+void SysCtrl_simClearAccessCount(void);
+SysCtrl_systemClock SysCtrl_simGetSystemClock(void);
+unsigned long SysCtrl_simGetCycles(void);
+void SysCtrl_simWaitForInterrupt(unsigned char deepSleep);
+void SysCtrl_simFailMosc(void);
+unsigned long SysCtrl_simGetSleepCount(unsigned char deepSleep);
+void SysCtrl_simSetMoscPresent(unsigned char present);
+void SysCtrl_simCaptureImage(SysCtrl_simImageType *image_ptr);
+void SysCtrl_simSetPioscDrift(long ppm);
+unsigned long SysCtrl_simMeasureClock(unsigned long periods);
+#endif  /* SYSCTRL_SIM_H */
+
+/**********************************************************************************************************************
+ *  END OF FILE: SysCtrl_sim.h
+ *********************************************************************************************************************/
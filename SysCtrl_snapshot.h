@@ -0,0 +1,76 @@
+/******************************************************************************
+ *
+ * Module: System Control
+ *
+ * File Name: SysCtrl_snapshot.h
+ *
+ * Description: Header File For The System Control State Snapshot
+ * SysCtrl_captureState copies the clock, status and gate registers into a packed, versioned
+ * record of byte fields, so the layout is the same on the target and on a host. Gate registers
+ * hold at most 8 instances and are kept as one byte per periphral. tools/SysCtrl_snapshotDecode.c
+ * turns records into field level reports.
+ *
+ * Author: Sayed Mohsen
+ *
+ *******************************************************************************/
+#ifndef SYSCTRL_SNAPSHOT_H
+#define SYSCTRL_SNAPSHOT_H
+
+/**********************************************************************************************************************
+ * INCLUDES
+ *********************************************************************************************************************/
+#include "SysCtrl.h"
+
+/**********************************************************************************************************************
+ *  GLOBAL CONSTANT MACROS
+ *********************************************************************************************************************/
+
+/*Record Signature ("SN") And Layout Version*/
+#define SYSCTRL_SNAPSHOT_MAGIC_0    (0x53U)
+#define SYSCTRL_SNAPSHOT_MAGIC_1    (0x4EU)
+#define SYSCTRL_SNAPSHOT_VERSION    (1U)
+
+/*Captured Registers (reg[] index)*/
+#define SYSCTRL_SNAPSHOT_RCC        (0U)
+#define SYSCTRL_SNAPSHOT_RCC2       (1U)
+#define SYSCTRL_SNAPSHOT_RIS        (2U)
+#define SYSCTRL_SNAPSHOT_PLLSTAT    (3U)
+#define SYSCTRL_SNAPSHOT_RESC       (4U)
+#define SYSCTRL_SNAPSHOT_REGS       (5U)
+
+/*Captured Gate Blocks (gate[] index)*/
+#define SYSCTRL_SNAPSHOT_RCGC       (0U)
+#define SYSCTRL_SNAPSHOT_SCGC       (1U)
+#define SYSCTRL_SNAPSHOT_DCGC       (2U)
+#define SYSCTRL_SNAPSHOT_PR         (3U)
+#define SYSCTRL_SNAPSHOT_GATE_BLOCKS (4U)
+
+/*SysCtrl_snapshotDiff Result .. one bit per register, then one bit per gate block*/
+#define SYSCTRL_SNAPSHOT_REG_CHANGED(reg)    (1U << (reg))
+#define SYSCTRL_SNAPSHOT_GATE_CHANGED(block) (1U << (SYSCTRL_SNAPSHOT_REGS + (block)))
+
+/**********************************************************************************************************************
+ *  GLOBAL DATA TYPES AND STRUCTURES
+ *********************************************************************************************************************/
+
+/*State Snapshot (92 bytes) .. multi byte values are little endian*/
+typedef struct {
+	unsigned char magic[2];
+	unsigned char version;/*SYSCTRL_SNAPSHOT_VERSION*/
+	unsigned char size;/*sizeof(SysCtrl_snapshotType)*/
+	unsigned char timestamp[4];/*Cycle Counter At Capture*/
+	unsigned char reg[SYSCTRL_SNAPSHOT_REGS][4];
+	unsigned char gate[SYSCTRL_SNAPSHOT_GATE_BLOCKS][SYSCTRL_NUM_OF_PERIPHRALS];/*Instance Bits*/
+}SysCtrl_snapshotType;
+
+/**********************************************************************************************************************
+ *  GLOBAL FUNCTION PROTOTYPES
+ *********************************************************************************************************************/
+void SysCtrl_captureState(SysCtrl_snapshotType *snapshot_ptr);
+unsigned short SysCtrl_snapshotDiff(const SysCtrl_snapshotType *old_ptr, const SysCtrl_snapshotType *new_ptr, SysCtrl_snapshotType *diff_ptr);
+unsigned long SysCtrl_snapshotReg(const SysCtrl_snapshotType *snapshot_ptr, unsigned char reg);
+#endif  /* SYSCTRL_SNAPSHOT_H */
+
+/**********************************************************************************************************************
+ *  END OF FILE: SysCtrl_snapshot.h
+ *********************************************************************************************************************/
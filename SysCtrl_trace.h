@@ -0,0 +1,86 @@
+/******************************************************************************
+ *
+ * Module: System Control
+ *
+ * File Name: SysCtrl_trace.h
+ *
+ * Description: Header File For The System Control Event Trace
+ * Fixed size binary records stamped with the cycle counter, written to a lock-free ring
+ * buffer in SysCtrl.c. Built only with SYSCTRL_TRACE == 1, otherwise every trace point
+ * expands to nothing. tools/SysCtrl_traceDecode.c renders a dump as a timeline.
+ *
+ * Author: Sayed Mohsen
+ *
+ *******************************************************************************/
+#ifndef SYSCTRL_TRACE_H
+#define SYSCTRL_TRACE_H
+
+/**********************************************************************************************************************
+ * INCLUDES
+ *********************************************************************************************************************/
+#include "SysCtrl_Cfg.h"
+
+/**********************************************************************************************************************
+ *  GLOBAL CONSTANT MACROS
+ *********************************************************************************************************************/
+
+/*Trace Buffer Signature ("SCTR")*/
+#define SYSCTRL_TRACE_MAGIC       (0x52544353UL)
+
+/*Trace Events .. param / value meaning per event*/
+#define SYSCTRL_TRACE_CLOCK_SOURCE_SET  (1U)  /*param clock source, value RCC2 image*/
+#define SYSCTRL_TRACE_PLL_POWER_UP      (2U)  /*param lock attempt*/
+#define SYSCTRL_TRACE_PLL_LOCKED        (3U)  /*value cycles since programming*/
+#define SYSCTRL_TRACE_BYPASS_REMOVED    (4U)  /*value system clock in Hz*/
+#define SYSCTRL_TRACE_CLOCK_FALLBACK    (5U)  /*value fallback clock in Hz*/
+#define SYSCTRL_TRACE_GATE_ENABLE       (6U)  /*param periphral, value instance mask*/
+#define SYSCTRL_TRACE_GATE_DISABLE      (7U)  /*param periphral, value instance mask*/
+#define SYSCTRL_TRACE_PERIPHERAL_READY  (8U)  /*param periphral, value instance mask*/
+#define SYSCTRL_TRACE_SLEEP             (9U)  /*param SysCtrl_powerModeType*/
+#define SYSCTRL_TRACE_WAKE              (10U) /*value wake latency in cycles*/
+#define SYSCTRL_TRACE_MOSC_FAILURE      (11U) /*value system clock before failover*/
+#define SYSCTRL_TRACE_SHADOW_MISMATCH   (12U) /*param register offset, value hardware content*/
+#define SYSCTRL_TRACE_PIOSC_TRIM        (13U) /*param user trim, value measured PIOSC in Hz*/
+#define SYSCTRL_TRACE_RESET_ASSERT      (14U) /*param periphral, value instance mask*/
+#define SYSCTRL_TRACE_RESET_RELEASE     (15U) /*param periphral, value instance mask*/
+
+/*Trace Point*/
+#if (SYSCTRL_TRACE == 1U)
+#define SYSCTRL_TRACE_EVENT(event, param, value) SysCtrl_traceRecord((event), (unsigned short)(param), (unsigned long)(value))
+#else
+#define SYSCTRL_TRACE_EVENT(event, param, value) ((void)0)
+#endif
+
+/**********************************************************************************************************************
+ *  GLOBAL DATA TYPES AND STRUCTURES
+ *********************************************************************************************************************/
+
+/*Trace Record (12 bytes, little endian on the target)*/
+typedef struct {
+	unsigned long timestamp;/*Cycle Counter*/
+	unsigned short event;/*SYSCTRL_TRACE_xxx*/
+	unsigned short param;
+	unsigned long value;
+}SysCtrl_traceRecordType;
+
+/*Trace Buffer .. dumped as is for the host decoder*/
+typedef struct {
+	unsigned long magic;/*SYSCTRL_TRACE_MAGIC*/
+	unsigned long depth;/*SYSCTRL_TRACE_DEPTH*/
+	unsigned long head;/*Records Ever Written, Slot head % depth Is Next*/
+	SysCtrl_traceRecordType record[SYSCTRL_TRACE_DEPTH];
+}SysCtrl_traceBufferType;
+
+/**********************************************************************************************************************
+ *  GLOBAL FUNCTION PROTOTYPES
+ *********************************************************************************************************************/
+#if (SYSCTRL_TRACE == 1U)
+void SysCtrl_traceRecord(unsigned short event, unsigned short param, unsigned long value);
+const SysCtrl_traceBufferType *SysCtrl_traceGetBuffer(void);
+void SysCtrl_traceClear(void);
+#endif
+#endif  /* SYSCTRL_TRACE_H */
+
+/**********************************************************************************************************************
+ *  END OF FILE: SysCtrl_trace.h
+ *********************************************************************************************************************/
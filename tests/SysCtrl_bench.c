@@ -0,0 +1,261 @@
+/******************************************************************************
+ *
+ * Module: System Control
+ *
+ * File Name: SysCtrl_bench.c
+ *
+ * Description: Host Side Register Access Benchmark
+ * Runs the main SysCtrl entry points against the SYSCTL simulator from power on reset (a fresh
+ * process per entry, so no driver state carries over) and prints the register accesses each one
+ * costs (SysCtrl_simGetAccessCount) and the RCGCUART gates it leaves. The records are compared
+ * against the checked-in golden file; any difference fails the run.
+ * Built with SYSCTRL_GATE_ACCESS_BITBAND (SysCtrl_bench_bitband) every gate entry point has to store
+ * each gate bit with one write and no read-modify-write. Built with SYSCTRL_SHADOW_REGISTERS
+ * (SysCtrl_bench_shadow) the profile switch scenario has to take fewer bus transfers than without.
+ * Given the golden file of the plain build as a reference, both check that they leave the same
+ * RCGCUART gates and print the bus transfers of both builds side by side.
+ *
+ *   make bench                                                -> compare
+ *   ./SysCtrl_bench --update <golden file>                    -> regenerate after an intended change
+ *   ./SysCtrl_bench_bitband <golden file> <reference golden>  -> compare, against the plain build
+ *   ./SysCtrl_bench_shadow <golden file> <reference golden>   -> compare, against the plain build
+ *
+ * Author: Sayed Mohsen
+ *
+ *******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "SysCtrl.h"
+#include "SysCtrl_map.h"
+#include "SysCtrl_sim.h"
+
+/*Entry Point Under Measurement .. setup runs before the access counters are cleared*/
+typedef struct {
+	const char *name;
+	void (*setup)(void);
+	void (*run)(void);
+	unsigned long gateBits;/*Gate Bits Changed .. bit-band stores expected, 0 -> not a gate entry point*/
+}benchType;
+
+/*Result Of One Entry*/
+typedef struct {
+	SysCtrl_simAccessCountType access;
+	unsigned long rcgcUart;
+}benchResultType;
+
+static void benchInitSystemClock(void)
+{
+	(void)SysCtrl_initSystemClock(&sysCtrl_Config);
+}
+
+static void benchInitPll(void)
+{
+	(void)SysCtrl_initPLL(PLL_400MHZ, 80000000UL);
+}
+
+static void benchPeripheralEnable(void)
+{
+	SysCtrl_peripheralEnable(SYSCTL_CUART, 0);
+}
+
+/*UART0 .. UART3 Open*/
+static void benchOpenUarts(void)
+{
+	SysCtrl_periphralSetType set = {{0}};
+
+	set.instanceMask[SYSCTL_CUART] = 0xFUL;
+	(void)SysCtrl_peripheralEnableSet(&set);
+}
+
+static void benchPeripheralDisable(void)
+{
+	SysCtrl_peripheralDisable(SYSCTL_CUART, 2);
+}
+
+static void benchPeripheralEnableSet(void)
+{
+	SysCtrl_periphralSetType set = {{0}};
+
+	SYSCTRL_PERIPHRAL_SET_ADD(set, SYSCTL_CUART, 0);
+	SYSCTRL_PERIPHRAL_SET_ADD(set, SYSCTL_CUART, 1);
+	SYSCTRL_PERIPHRAL_SET_ADD(set, SYSCTL_CUART, 3);
+	(void)SysCtrl_peripheralEnableSet(&set);
+}
+
+static void benchPeripheralDisableSet(void)
+{
+	SysCtrl_periphralSetType set = {{0}};
+
+	SYSCTRL_PERIPHRAL_SET_ADD(set, SYSCTL_CUART, 1);
+	SYSCTRL_PERIPHRAL_SET_ADD(set, SYSCTL_CUART, 3);
+	SysCtrl_peripheralDisableSet(&set);
+}
+
+/*Ten Profile Switches Round The Profile Table Plus One UART1 Gate Toggle*/
+static void benchProfileSwitches(void)
+{
+	unsigned int index;
+
+	for (index = 0; index < 10; index++)
+	{
+		(void)SysCtrl_switchProfile((SysCtrl_profileIdType)(index % SYSCTRL_NUM_OF_PROFILES));
+	}
+	SysCtrl_peripheralEnable(SYSCTL_CUART, 1);
+	SysCtrl_peripheralDisable(SYSCTL_CUART, 1);
+}
+
+static const benchType g_bench[] =
+{
+	{"SysCtrl_initSystemClock", (void *)0, benchInitSystemClock, 0},
+	{"SysCtrl_initPLL", (void *)0, benchInitPll, 0},
+	{"SysCtrl_peripheralEnable", (void *)0, benchPeripheralEnable, 1},
+	{"SysCtrl_peripheralDisable", benchOpenUarts, benchPeripheralDisable, 1},
+	{"SysCtrl_peripheralEnableSet", (void *)0, benchPeripheralEnableSet, 3},
+	{"SysCtrl_peripheralDisableSet", benchOpenUarts, benchPeripheralDisableSet, 2},
+	{"switchProfile x10 + UART1", benchInitSystemClock, benchProfileSwitches, 0}
+};
+
+#define BENCH_ENTRIES (sizeof(g_bench) / sizeof(g_bench[0]))
+
+/*Measure One Entry In A Child Process*/
+static void benchMeasure(const benchType *bench_ptr, benchResultType *result_ptr)
+{
+	int channel[2];
+	pid_t child;
+
+	if ((pipe(channel) != 0) || ((child = fork()) < 0))
+	{
+		perror("fork");
+		exit(2);
+	}
+	if (child == 0)
+	{
+		close(channel[0]);
+		SysCtrl_simReset();
+		if (bench_ptr->setup != (void *)0)
+		{
+			bench_ptr->setup();
+			SysCtrl_simClearAccessCount();
+		}
+		bench_ptr->run();
+		SysCtrl_simGetAccessCount(&result_ptr->access);
+		result_ptr->rcgcUart = SysCtrl_simPeek(SYSCTL_RCGC_OFFSET + SYSCTL_RCGCUART_R_OFFSET);
+		_exit((write(channel[1], result_ptr, sizeof(*result_ptr)) == (ssize_t)sizeof(*result_ptr)) ? 0 : 1);
+	}
+	close(channel[1]);
+	if (read(channel[0], result_ptr, sizeof(*result_ptr)) != (ssize_t)sizeof(*result_ptr))
+	{
+		memset(result_ptr, 0xFF, sizeof(*result_ptr));
+	}
+	close(channel[0]);
+	(void)waitpid(child, (void *)0, 0);
+}
+
+int main(int argc, char **argv)
+{
+	int update = (argc > 1) && (strcmp(argv[1], "--update") == 0);
+	const char *path = (argc > (1 + update)) ? argv[1 + update] : "SysCtrl_bench.golden";
+	const char *referencePath = (argc > (2 + update)) ? argv[2 + update] : (void *)0;
+	FILE *golden = fopen(path, update ? "w" : "r");
+	FILE *reference = (referencePath != (void *)0) ? fopen(referencePath, "r") : (void *)0;
+	benchResultType result;
+	char record[160];
+	char expected[160];
+	unsigned long referenceBus[BENCH_ENTRIES];
+	unsigned long bus[BENCH_ENTRIES];
+	unsigned long differences = 0;
+	unsigned long violations = 0;
+	unsigned int index;
+
+	if ((golden == NULL) || ((referencePath != (void *)0) && (reference == NULL)))
+	{
+		fprintf(stderr, "cannot open %s\n", (golden == NULL) ? path : referencePath);
+		return 2;
+	}
+
+	for (index = 0; index < BENCH_ENTRIES; index++)
+	{
+		benchMeasure(&g_bench[index], &result);
+		bus[index] = result.access.busAccesses;
+		snprintf(record, sizeof(record), "%-28s reads=%-4lu writes=%-4lu rmw=%-4lu bus=%-4lu rcgcuart=0x%02lX\n", g_bench[index].name,
+		         result.access.reads, result.access.writes, result.access.readModifyWrites, result.access.busAccesses,
+		         result.rcgcUart);
+		fputs(record, stdout);
+
+#if (SYSCTRL_GATE_ACCESS == SYSCTRL_GATE_ACCESS_BITBAND)
+		/*One Store Per Gate Bit, Never A Read-Modify-Write*/
+		if ((g_bench[index].gateBits != 0) &&
+		    ((result.access.readModifyWrites != 0) || (result.access.writes != g_bench[index].gateBits)))
+		{
+			fprintf(stderr, "%s: %lu writes and %lu read-modify-writes, expected %lu bit-band stores\n", g_bench[index].name,
+			        result.access.writes, result.access.readModifyWrites, g_bench[index].gateBits);
+			violations++;
+		}
+#endif
+
+		/*Same Gates As The Reference Build*/
+		if (reference != (void *)0)
+		{
+			expected[0] = '\0';
+			referenceBus[index] = 0;
+			if ((fgets(expected, sizeof(expected), reference) == NULL) || (strstr(expected, "rcgcuart=") == NULL) ||
+			    (sscanf(strstr(expected, "bus="), "bus=%lu", &referenceBus[index]) != 1) ||
+			    (strcmp(strstr(expected, "rcgcuart="), strstr(record, "rcgcuart=")) != 0))
+			{
+				fprintf(stderr, "%s: gates differ from %s\n  reference: %s  actual:    %s", g_bench[index].name, referencePath,
+				        expected, record);
+				violations++;
+			}
+#if (SYSCTRL_SHADOW_REGISTERS == 1U)
+			/*The Shadow Has To Pay Off Once It Is In Sync*/
+			if ((g_bench[index].run == benchProfileSwitches) && (result.access.busAccesses >= referenceBus[index]))
+			{
+				fprintf(stderr, "%s: %lu bus transfers with the shadow, %lu without\n", g_bench[index].name, result.access.busAccesses,
+				        referenceBus[index]);
+				violations++;
+			}
+#endif
+		}
+
+		if (update)
+		{
+			fputs(record, golden);
+		}
+		else
+		{
+			expected[0] = '\0';
+			if ((fgets(expected, sizeof(expected), golden) == NULL) || (strcmp(expected, record) != 0))
+			{
+				fprintf(stderr, "%s\n  golden: %s  actual: %s", g_bench[index].name, expected, record);
+				differences++;
+			}
+		}
+	}
+
+	if ((!update) && (fgets(expected, sizeof(expected), golden) != NULL))
+	{
+		fprintf(stderr, "%s has records past %u\n", path, index);
+		differences++;
+	}
+	fclose(golden);
+	if (reference != (void *)0)
+	{
+		fclose(reference);
+		printf("%-28s %9s %6s\n", "bus transfers", "reference", "build");
+		for (index = 0; index < BENCH_ENTRIES; index++)
+		{
+			printf("%-28s %9lu %6lu\n", g_bench[index].name, referenceBus[index], bus[index]);
+		}
+	}
+
+	printf("bench: %u entry points, %lu golden differences, %lu gate mismatches%s\n", index, differences, violations,
+	       update ? " (golden regenerated)" : "");
+	return ((differences == 0) && (violations == 0)) ? 0 : 1;
+}
+
+/**********************************************************************************************************************
+ *  END OF FILE: SysCtrl_bench.c
+ *********************************************************************************************************************/
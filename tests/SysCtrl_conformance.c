@@ -0,0 +1,223 @@
+/******************************************************************************
+ *
+ * Module: System Control
+ *
+ * File Name: SysCtrl_conformance.c
+ *
+ * Description: Host Side Clock Configuration Conformance Suite
+ * Resolves every clock source x crystal x PLL usage x PLL frequency x desired clock the way
+ * SYSCTRL_CLOCK_CONFIG does, runs SysCtrl_initSystemClock on the SYSCTL simulator from power
+ * on reset (a fresh process per combination, so no driver state carries over) and records RCC, RCC2, the achieved clock and the register access counts
+ * (SysCtrl_simCaptureImage). The records are compared against the checked-in golden file;
+ * any difference, or a decoded clock that differs from achievedClock, fails the run.
+ * An unresolved configuration (rcc2Image 0) has to be refused without touching a register.
+ *
+ *   make conformance                             -> compare
+ *   ./SysCtrl_conformance --update <golden file> -> regenerate after an intended change
+ *
+ * Author: Sayed Mohsen
+ *
+ *******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "SysCtrl.h"
+#include "SysCtrl_clockTree.h"
+#include "SysCtrl_sim.h"
+
+/*Differences Printed Before The Rest Are Only Counted*/
+#define CONFORMANCE_MAX_REPORTED    (20UL)
+
+/*Clock Sources Under Test*/
+static const SysCtrl_ClockSourceType g_sources[] =
+{
+	CLOCK_SOURCE_MAIN_OSCILLATOR,
+	CLOCK_SOURCE_PRECISION_INTERNAL_OSCILLATOR,
+	CLOCK_SOURCE_PRECISION_INTERNAL_OSCILLATOR_DIVDED_4,
+	CLOCK_SOURCE_LOW_FREQUENCY_INTERNAL_OSCILLATOR,
+	CLOCK_SOURCE_HIBERNTION_OSCILLATOR
+};
+static const char * const g_sourceNames[] = {"MOSC", "PIOSC", "PIOSC/4", "LFIOSC", "XTAL32K"};
+
+/*Desired Clocks .. exact PLL, crystal and internal oscillator rates plus one above the 80 MHz limit*/
+static const SysCtrl_systemClock g_desiredClocks[] =
+{
+	100000000UL, 80000000UL, 66666666UL, 50000000UL, 40000000UL, 25000000UL, 20000000UL,
+	16000000UL, 12000000UL, 10000000UL, 8000000UL, 5000000UL, 4000000UL, 1000000UL, 32768UL, 30000UL
+};
+
+#define CONFORMANCE_COUNT_OF(array) (sizeof(array) / sizeof((array)[0]))
+
+/*Resolve One Combination Like SYSCTRL_CLOCK_CONFIG .. returns 0 for a combination the build would reject*/
+static int conformanceResolve(SysCtrl_ClockSourceType src, SysCtrl_ExternalCrystalValueType xtal, SysCtrl_pllUsageType plluse,
+                              SysCtrl_pllFreqType pll, SysCtrl_systemClock clk, SysCtrl_configType *config_ptr)
+{
+	if (!SYSCTRL_CLOCK_VALID(src, xtal, plluse, pll, clk))
+	{
+		return 0;
+	}
+	config_ptr->clocksource = src;
+	config_ptr->xtal = xtal;
+	config_ptr->plluse = plluse;
+	config_ptr->pll = pll;
+	config_ptr->desiredClock = clk;
+	config_ptr->rccImage = SYSCTRL_RCC_IMAGE(src, xtal);
+	config_ptr->rcc2Image = SYSCTRL_RCC2_IMAGE(src, xtal, plluse, pll, clk);
+	config_ptr->achievedClock = SYSCTRL_ACHIEVED_HZ(src, xtal, plluse, pll, clk);
+	return 1;
+}
+
+/*Format The Record Of One Combination .. returns 0 when the simulator disagrees with achievedClock*/
+static int conformanceRecord(unsigned int sourceIndex, SysCtrl_ExternalCrystalValueType xtal, SysCtrl_pllUsageType plluse,
+                             SysCtrl_pllFreqType pll, SysCtrl_systemClock clk, char *record, size_t size)
+{
+	SysCtrl_configType config;
+	SysCtrl_simImageType image;
+	SysCtrl_returnType status;
+	int channel[2];
+	pid_t child;
+	int length;
+
+	length = snprintf(record, size, "%-7s xtal=%-8lu %-5s %s desired=%-9lu ", g_sourceNames[sourceIndex],
+	                  (unsigned long)SYSCTRL_XTAL_HZ(xtal), (PLL_OPERATING_NORMALLY == plluse) ? "pll" : "nopll",
+	                  (PLL_400MHZ == pll) ? "400" : "200", (unsigned long)clk);
+
+	if (!conformanceResolve(g_sources[sourceIndex], xtal, plluse, pll, clk, &config))
+	{
+		snprintf(record + length, size - (size_t)length, "rejected\n");
+		return 1;
+	}
+
+	/*Driver Statics Start From Power On Reset Too .. the combination runs in a child process*/
+	if ((pipe(channel) != 0) || ((child = fork()) < 0))
+	{
+		perror("fork");
+		exit(2);
+	}
+	if (child == 0)
+	{
+		close(channel[0]);
+		SysCtrl_simReset();
+		status = SysCtrl_initSystemClock(&config);
+		SysCtrl_simCaptureImage(&image);
+		_exit(((write(channel[1], &status, sizeof(status)) == (ssize_t)sizeof(status)) &&
+		       (write(channel[1], &image, sizeof(image)) == (ssize_t)sizeof(image))) ? 0 : 1);
+	}
+	close(channel[1]);
+	if ((read(channel[0], &status, sizeof(status)) != (ssize_t)sizeof(status)) ||
+	    (read(channel[0], &image, sizeof(image)) != (ssize_t)sizeof(image)))
+	{
+		status = SYSCTRL_E_NOT_OK;
+		memset(&image, 0, sizeof(image));
+	}
+	close(channel[0]);
+	(void)waitpid(child, (void *)0, 0);
+
+	snprintf(record + length, size - (size_t)length,
+	         "status=%d rcc=0x%08lX rcc2=0x%08lX clock=%lu reads=%lu writes=%lu rmw=%lu bus=%lu\n",
+	         (int)status, image.rcc, image.rcc2, (unsigned long)image.systemClock, image.access.reads,
+	         image.access.writes, image.access.readModifyWrites, image.access.busAccesses);
+
+	return (status == SYSCTRL_E_OK) && (image.systemClock == config.achievedClock);
+}
+
+/*A Configuration Filled Field By Field Without SYSCTRL_CLOCK_CONFIG Is Refused Before Any Register Access*/
+static int conformanceUnresolved(void)
+{
+	SysCtrl_configType config = {CLOCK_SOURCE_MAIN_OSCILLATOR, XTAL_16MHZ, PLL_OPERATING_NORMALLY, PLL_400MHZ, 80000000UL, 0, 0, 0};
+	SysCtrl_simAccessCountType count;
+	SysCtrl_returnType status;
+
+	SysCtrl_simReset();
+	status = SysCtrl_initSystemClock(&config);
+	SysCtrl_simGetAccessCount(&count);
+	if ((status != SYSCTRL_E_NOT_OK) || (count.busAccesses != 0))
+	{
+		fprintf(stderr, "unresolved configuration: status %d after %lu bus accesses, expected %d after none\n",
+		        (int)status, count.busAccesses, (int)SYSCTRL_E_NOT_OK);
+		return 0;
+	}
+	return 1;
+}
+
+int main(int argc, char **argv)
+{
+	int update = (argc > 1) && (strcmp(argv[1], "--update") == 0);
+	const char *path = (argc > (1 + update)) ? argv[1 + update] : "SysCtrl_conformance.golden";
+	FILE *golden = fopen(path, update ? "w" : "r");
+	char record[192];
+	char expected[192];
+	unsigned long records = 0;
+	unsigned long differences = 0;
+	unsigned long mismatches = 0;
+	unsigned int sourceIndex;
+	unsigned int xtal;
+	unsigned int plluse;
+	unsigned int pll;
+	unsigned int clockIndex;
+
+	if (golden == NULL)
+	{
+		fprintf(stderr, "cannot open %s\n", path);
+		return 2;
+	}
+
+	for (sourceIndex = 0; sourceIndex < CONFORMANCE_COUNT_OF(g_sources); sourceIndex++)
+	{
+		for (xtal = XTAL_4MHZ; xtal <= XTAL_25MHZ; xtal++)
+		{
+			for (plluse = PLL_OPERATING_NORMALLY; plluse <= PLL_POWERED_DOWM; plluse++)
+			{
+				for (pll = PLL_200MHZ; pll <= PLL_400MHZ; pll++)
+				{
+					for (clockIndex = 0; clockIndex < CONFORMANCE_COUNT_OF(g_desiredClocks); clockIndex++)
+					{
+						records++;
+						if (!conformanceRecord(sourceIndex, (SysCtrl_ExternalCrystalValueType)xtal, (SysCtrl_pllUsageType)plluse,
+						                       (SysCtrl_pllFreqType)pll, g_desiredClocks[clockIndex], record, sizeof(record)))
+						{
+							fprintf(stderr, "simulator disagrees with achievedClock: %s", record);
+							mismatches++;
+						}
+
+						if (update)
+						{
+							fputs(record, golden);
+						}
+						else
+						{
+							expected[0] = '\0';
+							if (((fgets(expected, sizeof(expected), golden) == NULL) || (strcmp(expected, record) != 0)) &&
+							    (differences++ < CONFORMANCE_MAX_REPORTED))
+							{
+								fprintf(stderr, "record %lu\n  golden: %s  actual: %s", records, expected, record);
+							}
+						}
+					}
+				}
+			}
+		}
+	}
+
+	if (!conformanceUnresolved())
+	{
+		mismatches++;
+	}
+
+	if ((!update) && (fgets(expected, sizeof(expected), golden) != NULL))
+	{
+		fprintf(stderr, "%s has records past %lu\n", path, records);
+		differences++;
+	}
+	fclose(golden);
+
+	printf("conformance: %lu records, %lu golden differences, %lu clock mismatches%s\n", records, differences, mismatches,
+	       update ? " (golden regenerated)" : "");
+	return ((differences == 0) && (mismatches == 0)) ? 0 : 1;
+}
+
+/**********************************************************************************************************************
+ *  END OF FILE: SysCtrl_conformance.c
+ *********************************************************************************************************************/
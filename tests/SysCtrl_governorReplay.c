@@ -0,0 +1,151 @@
+/******************************************************************************
+ *
+ * Module: System Control
+ *
+ * File Name: SysCtrl_governorReplay.c
+ *
+ * Description: Host Side Governor Replay
+ * Feeds a recorded load trace through SysCtrl_governorSample / SysCtrl_governorMainFunction
+ * against the SYSCTL simulator and checks the profile picked after every sample.
+ * Trace lines are "<busy ticks> <total ticks> <expected profile>" where the profile is the
+ * first word of its sysCtrl_Profiles name, or "policy <ondemand|conservative|fixed>".
+ * '#' starts a comment.
+ *
+ *   make replay
+ *
+ * Author: Sayed Mohsen
+ *
+ *******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "SysCtrl.h"
+#include "SysCtrl_governor.h"
+#include "SysCtrl_sim.h"
+
+/*Policy Names Accepted By The "policy" Line .. indexed by SysCtrl_governorPolicyType*/
+static const char * const g_policyNames[SYSCTRL_GOVERNOR_NUM_OF_POLICIES] =
+{
+	"ondemand",
+	"conservative",
+	"fixed"
+};
+
+/*Profile Whose Name Starts With The Given Word*/
+static SysCtrl_profileIdType replayProfileOf(const char *word)
+{
+	SysCtrl_profileIdType profileId;
+	size_t length = strlen(word);
+
+	for (profileId = 0; profileId < SYSCTRL_NUM_OF_PROFILES; profileId++)
+	{
+		if ((strncmp(sysCtrl_Profiles[profileId].name, word, length) == 0) &&
+		    ((sysCtrl_Profiles[profileId].name[length] == ' ') || (sysCtrl_Profiles[profileId].name[length] == '\0')))
+		{
+			break;
+		}
+	}
+	return profileId;
+}
+
+/*Apply A "policy" Line*/
+static int replayPolicy(const char *name)
+{
+	unsigned int policy;
+
+	for (policy = 0; policy < SYSCTRL_GOVERNOR_NUM_OF_POLICIES; policy++)
+	{
+		if (strcmp(g_policyNames[policy], name) == 0)
+		{
+			return (SysCtrl_governorSetPolicy((SysCtrl_governorPolicyType)policy) == SYSCTRL_E_OK) ? 0 : -1;
+		}
+	}
+	return -1;
+}
+
+int main(int argc, char **argv)
+{
+	const char *path = (argc > 1) ? argv[1] : "SysCtrl_governorReplay.trace";
+	char line[128];
+	char word[32];
+	unsigned long busyTicks;
+	unsigned long totalTicks;
+	unsigned long lineNumber = 0;
+	unsigned long samples = 0;
+	unsigned long failures = 0;
+	SysCtrl_profileIdType expected;
+	SysCtrl_profileIdType profileId;
+	SysCtrl_governorStatsType stats;
+	FILE *trace = fopen(path, "r");
+
+	if (trace == NULL)
+	{
+		fprintf(stderr, "cannot open %s\n", path);
+		return 2;
+	}
+
+	SysCtrl_simReset();
+	if ((SysCtrl_initSystemClock(&sysCtrl_Config) != SYSCTRL_E_OK) ||
+	    (SysCtrl_switchProfile(SYSCTRL_PROFILE_PERFORMANCE) != SYSCTRL_E_OK) ||
+	    (SysCtrl_governorInit(&sysCtrl_GovernorConfig) != SYSCTRL_E_OK))
+	{
+		fprintf(stderr, "governor setup failed\n");
+		fclose(trace);
+		return 2;
+	}
+
+	while (fgets(line, sizeof(line), trace) != NULL)
+	{
+		lineNumber++;
+		line[strcspn(line, "#\r\n")] = '\0';
+
+		if (sscanf(line, " policy %31s", word) == 1)
+		{
+			if (replayPolicy(word) != 0)
+			{
+				fprintf(stderr, "%s:%lu: bad policy '%s'\n", path, lineNumber, word);
+				failures++;
+			}
+			continue;
+		}
+
+		if (sscanf(line, "%lu %lu %31s", &busyTicks, &totalTicks, word) != 3)
+		{
+			if (sscanf(line, " %31s", word) == 1)
+			{
+				fprintf(stderr, "%s:%lu: cannot parse '%s'\n", path, lineNumber, line);
+				failures++;
+			}
+			continue;
+		}
+
+		expected = replayProfileOf(word);
+		if (expected >= SYSCTRL_NUM_OF_PROFILES)
+		{
+			fprintf(stderr, "%s:%lu: unknown profile '%s'\n", path, lineNumber, word);
+			failures++;
+			continue;
+		}
+
+		SysCtrl_governorSample(busyTicks, totalTicks);
+		(void)SysCtrl_governorMainFunction();
+		samples++;
+
+		profileId = SysCtrl_getProfile();
+		if (profileId != expected)
+		{
+			fprintf(stderr, "%s:%lu: load %lu/%lu -> '%s', expected '%s'\n", path, lineNumber, busyTicks, totalTicks,
+			        (profileId < SYSCTRL_NUM_OF_PROFILES) ? sysCtrl_Profiles[profileId].name : "none",
+			        sysCtrl_Profiles[expected].name);
+			failures++;
+		}
+	}
+	fclose(trace);
+
+	SysCtrl_governorGetStats(&stats);
+	printf("governor replay: %lu samples, %lu transitions, %lu failures\n", samples, stats.transitions, failures);
+	return (failures == 0) ? 0 : 1;
+}
+
+/**********************************************************************************************************************
+ *  END OF FILE: SysCtrl_governorReplay.c
+ *********************************************************************************************************************/
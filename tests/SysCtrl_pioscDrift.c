@@ -0,0 +1,156 @@
+/******************************************************************************
+ *
+ * Module: System Control
+ *
+ * File Name: SysCtrl_pioscDrift.c
+ *
+ * Description: Host Side PIOSC Drift Check
+ * Detunes the simulated PIOSC (SysCtrl_simSetPioscDrift) and checks that the measured drift is
+ * applied exactly once: planned configurations stay nominal, the reported system clock follows
+ * the real one for PIOSC and PIOSC + PLL clocks, and SysCtrl_calibratePiosc trims PIOSC back to
+ * the nominal 16 MHz.
+ *
+ *   make drift
+ *
+ * Author: Sayed Mohsen
+ *
+ *******************************************************************************/
+#include <stdio.h>
+#include "SysCtrl.h"
+#include "SysCtrl_clockTree.h"
+#include "SysCtrl_map.h"
+#include "SysCtrl_sim.h"
+
+/*Agreement Between Reported And Real Clocks .. a 0.1 s measurement resolves far better*/
+#define DRIFT_TOLERANCE_PPM    (1000UL)
+
+/*Simulated PIOSC Factory Trim (PIOSCSTAT CT)*/
+#define DRIFT_FACTORY_TRIM     (0x40UL)
+
+static unsigned long g_failures = 0;
+
+/*Temperature Drifts Under Test (ppm)*/
+static const long g_drifts[] = {-30000L, -12000L, 0L, 20000L, 25000L};
+
+static unsigned long driftMeasure(unsigned long periods)
+{
+	return SysCtrl_simMeasureClock(periods);
+}
+
+/*Capture Timer On The 32.768 kHz Clock .. 0.1 s per measurement*/
+static const SysCtrl_clockMeasureType g_measure = {driftMeasure, SYSCTRL_XTAL32K_HZ, 3277UL};
+
+static void driftCheck(int condition, long drift, const char *what, unsigned long value, unsigned long expected)
+{
+	if (!condition)
+	{
+		fprintf(stderr, "drift %+ld ppm: %s is %lu, expected %lu\n", drift, what, value, expected);
+		g_failures++;
+	}
+}
+
+static int driftClose(unsigned long value, unsigned long expected)
+{
+	unsigned long error = (value > expected) ? (value - expected) : (expected - value);
+
+	return ((unsigned long long)error * 1000000UL) <= ((unsigned long long)expected * DRIFT_TOLERANCE_PPM);
+}
+
+/*Plan A PIOSC Only Clock*/
+static SysCtrl_returnType driftPlan(SysCtrl_systemClock targetClock, unsigned long tolerancePermille, SysCtrl_configType *config_ptr)
+{
+	SysCtrl_planRequestType request;
+
+	request.goal = SYSCTRL_PLAN_CLOSEST;
+	request.targetClock = targetClock;
+	request.tolerancePermille = tolerancePermille;
+	request.xtal = XTAL_16MHZ;
+	request.allowedSources = SYSCTRL_PLAN_SOURCE(CLOCK_SOURCE_PRECISION_INTERNAL_OSCILLATOR);
+	return SysCtrl_planSystemClock(&request, config_ptr);
+}
+
+/*Clock The RCC2 Image Gives With A 16 MHz PIOSC*/
+static SysCtrl_systemClock driftNominalClock(const SysCtrl_configType *config_ptr)
+{
+	unsigned long rcc2 = config_ptr->rcc2Image;
+	SysCtrl_systemClock input = SYSCTRL_PIOSC_HZ;
+	unsigned long divisor = ((rcc2 >> SYSCTRL_RCC2_SYSDIV2_S) & 0x3FUL) + 1UL;
+
+	if ((rcc2 & SYSCTRL_RCC2_PWRDN2) == 0)
+	{
+		input = (rcc2 & SYSCTRL_RCC2_DIV400) ? SYSCTRL_PLL_400_HZ : SYSCTRL_PLL_200_HZ;
+	}
+	if (rcc2 & SYSCTRL_RCC2_DIV400)
+	{
+		divisor = ((rcc2 >> SYSCTRL_RCC2_SYSDIV2LSB_S) & 0x7FUL) + 1UL;
+	}
+	return input / divisor;
+}
+
+static void driftRun(long drift)
+{
+	SysCtrl_configType piosc;
+	SysCtrl_configType pioscPll;
+	SysCtrl_configType measured;
+	SysCtrl_systemClock measuredClock = 0;
+	unsigned long trim;
+
+	SysCtrl_simReset();
+	SysCtrl_simSetPioscDrift(drift);
+	driftCheck(SysCtrl_initSystemClock(&sysCtrl_FallbackConfig) == SYSCTRL_E_OK, drift, "init status", 1, 0);
+
+	/*Measured Clock Replaces The Nominal One*/
+	driftCheck(SysCtrl_measureSystemClock(&g_measure, &measuredClock) == SYSCTRL_E_OK, drift, "measure status", 1, 0);
+	driftCheck(driftClose(measuredClock, SysCtrl_simGetSystemClock()), drift, "measured clock", measuredClock, SysCtrl_simGetSystemClock());
+
+	/*Planner Results Stay Nominal Whatever Was Measured*/
+	driftCheck(driftPlan(16000000UL, 1, &piosc) == SYSCTRL_E_OK, drift, "plan 16 MHz status", 1, 0);
+	driftCheck(piosc.achievedClock == 16000000UL, drift, "planned PIOSC achievedClock", piosc.achievedClock, 16000000UL);
+	driftCheck(driftPlan(50000000UL, 1, &pioscPll) == SYSCTRL_E_OK, drift, "plan 50 MHz status", 1, 0);
+	driftCheck(pioscPll.achievedClock == 50000000UL, drift, "planned PIOSC + PLL achievedClock", pioscPll.achievedClock, 50000000UL);
+	driftCheck(driftPlan(measuredClock, 50, &measured) == SYSCTRL_E_OK, drift, "plan measured clock status", 1, 0);
+	driftCheck(measured.achievedClock == driftNominalClock(&measured), drift, "planned achievedClock for the measured clock",
+	           measured.achievedClock, driftNominalClock(&measured));
+
+	/*Drift Applied Once When The Clock Is Selected*/
+	driftCheck(SysCtrl_setSystemClock(&pioscPll) == SYSCTRL_E_OK, drift, "set PIOSC + PLL status", 1, 0);
+	driftCheck(driftClose(SysCtrl_getSystemClock(), SysCtrl_simGetSystemClock()), drift, "reported PIOSC + PLL clock",
+	           SysCtrl_getSystemClock(), SysCtrl_simGetSystemClock());
+	driftCheck(SysCtrl_setSystemClock(&measured) == SYSCTRL_E_OK, drift, "set planned measured clock status", 1, 0);
+	driftCheck(driftClose(SysCtrl_getSystemClock(), SysCtrl_simGetSystemClock()), drift, "reported planned measured clock",
+	           SysCtrl_getSystemClock(), SysCtrl_simGetSystemClock());
+	driftCheck(SysCtrl_setSystemClock(&piosc) == SYSCTRL_E_OK, drift, "set PIOSC status", 1, 0);
+	driftCheck(driftClose(SysCtrl_getSystemClock(), SysCtrl_simGetSystemClock()), drift, "reported PIOSC clock",
+	           SysCtrl_getSystemClock(), SysCtrl_simGetSystemClock());
+
+	/*Calibration Trims Back To The Nominal 16 MHz, Not To The Measured One*/
+	driftCheck(SysCtrl_calibratePiosc(&g_measure) == SYSCTRL_E_OK, drift, "calibrate status", 1, 0);
+	trim = SysCtrl_simPeek(SYSCTL_PIOSCCAL_R_OFFSET) & SYSCTL_PIOSCCAL_UT_M;
+	driftCheck((drift == 0) ? (trim == DRIFT_FACTORY_TRIM) : (trim != DRIFT_FACTORY_TRIM), drift, "user trim", trim, DRIFT_FACTORY_TRIM);
+	driftCheck(driftClose(SysCtrl_simGetSystemClock(), 16000000UL), drift, "trimmed PIOSC clock", SysCtrl_simGetSystemClock(), 16000000UL);
+	driftCheck(driftClose(SysCtrl_getSystemClock(), SysCtrl_simGetSystemClock()), drift, "reported trimmed clock",
+	           SysCtrl_getSystemClock(), SysCtrl_simGetSystemClock());
+	driftCheck(driftClose(SysCtrl_getOscillatorClock(CLOCK_SOURCE_PRECISION_INTERNAL_OSCILLATOR, XTAL_16MHZ), SysCtrl_simGetSystemClock()),
+	           drift, "reported PIOSC", SysCtrl_getOscillatorClock(CLOCK_SOURCE_PRECISION_INTERNAL_OSCILLATOR, XTAL_16MHZ),
+	           SysCtrl_simGetSystemClock());
+
+	printf("drift %+6ld ppm: measured %lu Hz, trim 0x%02lX, trimmed %lu Hz\n", drift, (unsigned long)measuredClock, trim,
+	       (unsigned long)SysCtrl_simGetSystemClock());
+}
+
+int main(void)
+{
+	unsigned int index;
+
+	for (index = 0; index < (sizeof(g_drifts) / sizeof(g_drifts[0])); index++)
+	{
+		driftRun(g_drifts[index]);
+	}
+
+	printf("piosc drift: %lu failures\n", g_failures);
+	return (g_failures == 0) ? 0 : 1;
+}
+
+/**********************************************************************************************************************
+ *  END OF FILE: SysCtrl_pioscDrift.c
+ *********************************************************************************************************************/
@@ -0,0 +1,149 @@
+/******************************************************************************
+ *
+ * Module: System Control
+ *
+ * File Name: SysCtrl_recover.c
+ *
+ * Description: Host Side Periphral Recovery Check
+ * Runs SysCtrl_peripheralRecoverSet against the SYSCTL simulator on sets mixing open, gated off and
+ * acquired instances, and checks that the RCGC gates come back exactly as they were, that only open
+ * instances are waited for in PRxxx, that gate reference counts are untouched and that the timing
+ * struct reports the reset hold.
+ *
+ *   make recover
+ *
+ * Author: Sayed Mohsen
+ *
+ *******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "SysCtrl.h"
+#include "SysCtrl_map.h"
+#include "SysCtrl_sim.h"
+
+/*Owner Used For The Acquired Gate*/
+#define RECOVER_OWNER    (1U)
+
+static unsigned long g_failures = 0;
+
+static const char * const g_actionNames[] = {"reset", "power cycle"};
+
+static void recoverCheck(int condition, SysCtrl_recoverActionType action, const char *what, unsigned long value, unsigned long expected)
+{
+	if (!condition)
+	{
+		fprintf(stderr, "%s: %s is 0x%lX, expected 0x%lX\n", g_actionNames[action], what, value, expected);
+		g_failures++;
+	}
+}
+
+/*UART0 / UART1 Open, UART2 Gated Off, SSI0 Held Through SysCtrl_peripheralAcquire*/
+static void recoverSetup(SysCtrl_periphralSetType *set_ptr)
+{
+	SysCtrl_simReset();
+	(void)SysCtrl_initSystemClock(&sysCtrl_Config);
+	SysCtrl_peripheralEnable(SYSCTL_CUART, 0);
+	SysCtrl_peripheralEnable(SYSCTL_CUART, 1);
+	(void)SysCtrl_peripheralAcquire(SYSCTL_CSSI, 0, RECOVER_OWNER);
+
+	memset(set_ptr, 0, sizeof(*set_ptr));
+	SYSCTRL_PERIPHRAL_SET_ADD(*set_ptr, SYSCTL_CUART, 0);
+	SYSCTRL_PERIPHRAL_SET_ADD(*set_ptr, SYSCTL_CUART, 1);
+	SYSCTRL_PERIPHRAL_SET_ADD(*set_ptr, SYSCTL_CUART, 2);
+	SYSCTRL_PERIPHRAL_SET_ADD(*set_ptr, SYSCTL_CSSI, 0);
+}
+
+static void recoverRun(SysCtrl_recoverActionType action)
+{
+	SysCtrl_periphralSetType set;
+	SysCtrl_recoverTimingType timing;
+	SysCtrl_returnType status;
+	unsigned long uartGates;
+	unsigned long ssiGates;
+
+	recoverSetup(&set);
+	uartGates = SysCtrl_simPeek(SYSCTL_RCGC_OFFSET + SYSCTL_RCGCUART_R_OFFSET);
+	ssiGates = SysCtrl_simPeek(SYSCTL_RCGC_OFFSET + SYSCTL_RCGCSSI_R_OFFSET);
+
+	/*A Gated Off Instance In The Set Must Not Time Out The Ready Wait*/
+	status = SysCtrl_peripheralRecoverSet(&set, action, &timing);
+	recoverCheck(status == SYSCTRL_E_OK, action, "status", (unsigned long)status, SYSCTRL_E_OK);
+
+	/*Gates Come Back Exactly As They Were .. UART2 stays off*/
+	recoverCheck(SysCtrl_simPeek(SYSCTL_RCGC_OFFSET + SYSCTL_RCGCUART_R_OFFSET) == uartGates, action, "RCGCUART",
+	             SysCtrl_simPeek(SYSCTL_RCGC_OFFSET + SYSCTL_RCGCUART_R_OFFSET), uartGates);
+	recoverCheck(SysCtrl_simPeek(SYSCTL_RCGC_OFFSET + SYSCTL_RCGCSSI_R_OFFSET) == ssiGates, action, "RCGCSSI",
+	             SysCtrl_simPeek(SYSCTL_RCGC_OFFSET + SYSCTL_RCGCSSI_R_OFFSET), ssiGates);
+
+	/*Every Instance Left Reset, The Open Ones Are Ready*/
+	recoverCheck(SysCtrl_simPeek(SYSCTL_SR_OFFSET + SYSCTL_RCGCUART_R_OFFSET) == 0, action, "SRUART",
+	             SysCtrl_simPeek(SYSCTL_SR_OFFSET + SYSCTL_RCGCUART_R_OFFSET), 0);
+	recoverCheck(SysCtrl_simPeek(SYSCTL_PR_OFFSET + SYSCTL_RCGCUART_R_OFFSET) == uartGates, action, "PRUART",
+	             SysCtrl_simPeek(SYSCTL_PR_OFFSET + SYSCTL_RCGCUART_R_OFFSET), uartGates);
+	recoverCheck(SysCtrl_simPeek(SYSCTL_PR_OFFSET + SYSCTL_RCGCSSI_R_OFFSET) == ssiGates, action, "PRSSI",
+	             SysCtrl_simPeek(SYSCTL_PR_OFFSET + SYSCTL_RCGCSSI_R_OFFSET), ssiGates);
+
+	/*Reference Counts Untouched .. the last release still closes the acquired gate*/
+	recoverCheck(SysCtrl_getPeripheralUsers(SYSCTL_CSSI, 0) == 1, action, "SSI0 users", SysCtrl_getPeripheralUsers(SYSCTL_CSSI, 0), 1);
+	(void)SysCtrl_peripheralRelease(SYSCTL_CSSI, 0, RECOVER_OWNER);
+	recoverCheck(SysCtrl_simPeek(SYSCTL_RCGC_OFFSET + SYSCTL_RCGCSSI_R_OFFSET) == 0, action, "RCGCSSI after release",
+	             SysCtrl_simPeek(SYSCTL_RCGC_OFFSET + SYSCTL_RCGCSSI_R_OFFSET), 0);
+
+	/*Timing Struct*/
+	recoverCheck(timing.holdCycles >= SYSCTRL_PERIPHERAL_RESET_HOLD_CYCLES, action, "holdCycles", timing.holdCycles,
+	             SYSCTRL_PERIPHERAL_RESET_HOLD_CYCLES);
+	recoverCheck(timing.assertCycles != 0, action, "assertCycles", timing.assertCycles, 1);
+	recoverCheck(timing.releaseCycles != 0, action, "releaseCycles", timing.releaseCycles, 1);
+	recoverCheck(timing.readyCycles != 0, action, "readyCycles", timing.readyCycles, 1);
+
+	printf("recover %-11s: assert %lu, hold %lu, release %lu, ready %lu cycles\n", g_actionNames[action], timing.assertCycles,
+	       timing.holdCycles, timing.releaseCycles, timing.readyCycles);
+}
+
+/*Only Gated Off Instances .. reset is asserted and released, nothing is waited for*/
+static void recoverGatedOff(void)
+{
+	SysCtrl_periphralSetType set;
+	SysCtrl_recoverTimingType timing;
+	SysCtrl_returnType status;
+
+	SysCtrl_simReset();
+	(void)SysCtrl_initSystemClock(&sysCtrl_Config);
+	memset(&set, 0, sizeof(set));
+	SYSCTRL_PERIPHRAL_SET_ADD(set, SYSCTL_CI2C, 3);
+
+	status = SysCtrl_peripheralRecoverSet(&set, SYSCTRL_RECOVER_POWER_CYCLE, &timing);
+	recoverCheck(status == SYSCTRL_E_OK, SYSCTRL_RECOVER_POWER_CYCLE, "gated off status", (unsigned long)status, SYSCTRL_E_OK);
+	recoverCheck(SysCtrl_simPeek(SYSCTL_RCGC_OFFSET + SYSCTL_RCGCI2C_R_OFFSET) == 0, SYSCTRL_RECOVER_POWER_CYCLE, "gated off RCGCI2C",
+	             SysCtrl_simPeek(SYSCTL_RCGC_OFFSET + SYSCTL_RCGCI2C_R_OFFSET), 0);
+	recoverCheck(SysCtrl_simPeek(SYSCTL_SR_OFFSET + SYSCTL_RCGCI2C_R_OFFSET) == 0, SYSCTRL_RECOVER_POWER_CYCLE, "gated off SRI2C",
+	             SysCtrl_simPeek(SYSCTL_SR_OFFSET + SYSCTL_RCGCI2C_R_OFFSET), 0);
+	recoverCheck(timing.readyCycles == 0, SYSCTRL_RECOVER_POWER_CYCLE, "gated off readyCycles", timing.readyCycles, 0);
+}
+
+/*Bad Arguments Are Refused*/
+static void recoverArguments(void)
+{
+	SysCtrl_periphralSetType set;
+
+	memset(&set, 0, sizeof(set));
+	recoverCheck(SysCtrl_peripheralRecoverSet((void *)0, SYSCTRL_RECOVER_RESET, (void *)0) == SYSCTRL_E_NOT_OK, SYSCTRL_RECOVER_RESET,
+	             "NULL set refused", 0, 1);
+	recoverCheck(SysCtrl_peripheralRecoverSet(&set, (SysCtrl_recoverActionType)2, (void *)0) == SYSCTRL_E_NOT_OK, SYSCTRL_RECOVER_RESET,
+	             "unknown action refused", 0, 1);
+}
+
+int main(void)
+{
+	recoverRun(SYSCTRL_RECOVER_RESET);
+	recoverRun(SYSCTRL_RECOVER_POWER_CYCLE);
+	recoverGatedOff();
+	recoverArguments();
+
+	printf("periphral recovery: %lu failures\n", g_failures);
+	return (g_failures == 0) ? 0 : 1;
+}
+
+/**********************************************************************************************************************
+ *  END OF FILE: SysCtrl_recover.c
+ *********************************************************************************************************************/
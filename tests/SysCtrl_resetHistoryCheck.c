@@ -0,0 +1,170 @@
+/******************************************************************************
+ *
+ * Module: System Control
+ *
+ * File Name: SysCtrl_resetHistoryCheck.c
+ *
+ * Description: Host Side Reset History Check
+ * Boots the driver repeatedly on the SYSCTL simulator with a reset cause latched through
+ * SysCtrl_simSetResetCause, wraps the ring buffer and checks every entry and cause count.
+ * Then scribbles over structure padding (must be ignored) and over one entry (must be
+ * detected, the history is rebuilt). The driver sources are included so a boot can clear
+ * the driver statics the way startup code does, while the no-init history survives.
+ *
+ *   make history
+ *
+ * Author: Sayed Mohsen
+ *
+ *******************************************************************************/
+#include <stdio.h>
+#include <stddef.h>
+#include "../SysCtrl.c"
+#include "../SysCtrl_resetHistory.c"
+#include "SysCtrl_sim.h"
+
+/*Boots Logged Before The Corruption Checks .. wraps the ring buffer*/
+#define HISTORY_BOOTS    (SYSCTRL_RESET_HISTORY_DEPTH + 3U)
+
+static unsigned long g_failures = 0;
+
+/*Cause, Clock Profile And Uptime (Ticks) Of Each Boot*/
+static const SysCtrl_resetCauseType g_causes[] =
+{
+	SYSCTRL_POWER_ON_RESET, SYSCTRL_EXTERNAL_RESET, SYSCTRL_WDT0_RESET, SYSCTRL_SOFTWARE_RESET,
+	SYSCTRL_BROWN_OUT_RESET, SYSCTRL_WDT1_RESET, SYSCTRL_MOSC_FAILURE_RESET, SYSCTRL_WDT0_RESET | SYSCTRL_SOFTWARE_RESET
+};
+#define HISTORY_CAUSE(boot)      (g_causes[(boot) % (sizeof(g_causes) / sizeof(g_causes[0]))])
+#define HISTORY_PROFILE(boot)    ((SysCtrl_profileIdType)((boot) % SYSCTRL_NUM_OF_PROFILES))
+#define HISTORY_TICKS(boot)      (100UL + (boot))
+
+static void historyCheck(int condition, const char *what, unsigned long value, unsigned long expected)
+{
+	if (!condition)
+	{
+		fprintf(stderr, "%s is 0x%lX, expected 0x%lX\n", what, value, expected);
+		g_failures++;
+	}
+}
+
+/*One Boot .. RESC latched, driver statics cleared, no-init RAM kept*/
+static SysCtrl_returnType historyBoot(unsigned long boot)
+{
+	SysCtrl_returnType status;
+	unsigned long tick;
+
+	g_resetCause = 0;
+	SysCtrl_simReset();
+	SysCtrl_simSetResetCause(HISTORY_CAUSE(boot));
+	status = SysCtrl_resetHistoryInit();
+
+	(void)SysCtrl_initSystemClock(&sysCtrl_Config);
+	(void)SysCtrl_switchProfile(HISTORY_PROFILE(boot));
+	for (tick = 0; tick < HISTORY_TICKS(boot); tick++)
+	{
+		SysCtrl_resetHistoryTick();
+	}
+	return status;
+}
+
+/*Entry Of A Boot .. when and on which profile the boot before it ended*/
+static void historyCheckEntry(unsigned char age, unsigned long boot)
+{
+	SysCtrl_resetEntryType entry;
+
+	historyCheck(SysCtrl_resetHistoryGet(age, &entry) == SYSCTRL_E_OK, "get status", age, SYSCTRL_E_OK);
+	historyCheck(entry.sequence == boot, "sequence", entry.sequence, boot);
+	historyCheck(entry.cause == HISTORY_CAUSE(boot), "cause", entry.cause, HISTORY_CAUSE(boot));
+	historyCheck(entry.timestamp == ((boot == 0) ? 0 : HISTORY_TICKS(boot - 1)), "timestamp", entry.timestamp,
+	             (boot == 0) ? 0 : HISTORY_TICKS(boot - 1));
+	historyCheck(entry.profile == ((boot == 0) ? SYSCTRL_NUM_OF_PROFILES : HISTORY_PROFILE(boot - 1)), "profile", entry.profile,
+	             (boot == 0) ? SYSCTRL_NUM_OF_PROFILES : HISTORY_PROFILE(boot - 1));
+}
+
+/*Cause Counts Of Boots first .. last*/
+static void historyCheckCounts(unsigned long first, unsigned long last)
+{
+	static const SysCtrl_resetCauseType kinds[] =
+	{
+		SYSCTRL_EXTERNAL_RESET, SYSCTRL_POWER_ON_RESET, SYSCTRL_BROWN_OUT_RESET, SYSCTRL_WDT0_RESET,
+		SYSCTRL_SOFTWARE_RESET, SYSCTRL_WDT1_RESET, SYSCTRL_MOSC_FAILURE_RESET
+	};
+	unsigned long expected;
+	unsigned long boot;
+	unsigned int kind;
+
+	for (kind = 0; kind < (sizeof(kinds) / sizeof(kinds[0])); kind++)
+	{
+		expected = 0;
+		for (boot = first; boot <= last; boot++)
+		{
+			expected += ((HISTORY_CAUSE(boot) & kinds[kind]) != 0);
+		}
+		historyCheck(SysCtrl_resetHistoryCauseCount(kinds[kind]) == expected, "cause count", SysCtrl_resetHistoryCauseCount(kinds[kind]),
+		             expected);
+	}
+}
+
+int main(void)
+{
+	SysCtrl_resetRecordType *record_ptr;
+	SysCtrl_resetEntryType entry;
+	unsigned char *byte_ptr;
+	unsigned long boot;
+	unsigned long padding = 0;
+	unsigned char age;
+
+	/*First Boot Finds No History*/
+	historyCheck(historyBoot(0) == SYSCTRL_E_NOT_OK, "first boot status", SYSCTRL_E_OK, SYSCTRL_E_NOT_OK);
+
+	/*Wrap The Ring Buffer .. the oldest entries drop out, the cause counts keep every boot*/
+	for (boot = 1; boot < HISTORY_BOOTS; boot++)
+	{
+		historyCheck(historyBoot(boot) == SYSCTRL_E_OK, "boot status", SYSCTRL_E_NOT_OK, SYSCTRL_E_OK);
+	}
+	historyCheck(SysCtrl_resetHistoryCount() == SYSCTRL_RESET_HISTORY_DEPTH, "entries", SysCtrl_resetHistoryCount(),
+	             SYSCTRL_RESET_HISTORY_DEPTH);
+	for (age = 0; age < SYSCTRL_RESET_HISTORY_DEPTH; age++)
+	{
+		historyCheckEntry(age, HISTORY_BOOTS - 1 - age);
+	}
+	historyCheckCounts(0, HISTORY_BOOTS - 1);
+
+	/*Padding Is Not Part Of The History .. scribbling over it must not rebuild*/
+	byte_ptr = (unsigned char *)&g_resetHistory;
+	for (boot = offsetof(SysCtrl_resetHistoryBlockType, causeCount) + sizeof(g_resetHistory.causeCount);
+	     boot < offsetof(SysCtrl_resetHistoryBlockType, record); boot++)
+	{
+		byte_ptr[boot] ^= 0xA5;
+		padding++;
+	}
+	byte_ptr = (unsigned char *)&g_resetHistory.record[0];
+	for (boot = offsetof(SysCtrl_resetRecordType, profile) + 1; boot < offsetof(SysCtrl_resetRecordType, timestamp); boot++)
+	{
+		byte_ptr[boot] ^= 0xA5;
+		padding++;
+	}
+	historyCheck(historyBoot(HISTORY_BOOTS) == SYSCTRL_E_OK, "status after padding scribble", SYSCTRL_E_NOT_OK, SYSCTRL_E_OK);
+	historyCheck(SysCtrl_resetHistoryCount() == SYSCTRL_RESET_HISTORY_DEPTH, "entries after padding scribble",
+	             SysCtrl_resetHistoryCount(), SYSCTRL_RESET_HISTORY_DEPTH);
+
+	/*One Corrupt Entry .. detected, the history restarts with this boot*/
+	record_ptr = &g_resetHistory.record[(g_resetHistory.head + 2) % SYSCTRL_RESET_HISTORY_DEPTH];
+	record_ptr->timestamp ^= 0x100UL;
+	historyCheck(historyBoot(HISTORY_BOOTS + 1) == SYSCTRL_E_NOT_OK, "status after corruption", SYSCTRL_E_OK, SYSCTRL_E_NOT_OK);
+	historyCheck(SysCtrl_resetHistoryCount() == 1, "entries after corruption", SysCtrl_resetHistoryCount(), 1);
+	historyCheckCounts(HISTORY_BOOTS + 1, HISTORY_BOOTS + 1);
+	historyCheck(SysCtrl_resetHistoryGet(1, &entry) == SYSCTRL_E_NOT_OK, "get past the rebuilt entry",
+	             SYSCTRL_E_OK, SYSCTRL_E_NOT_OK);
+
+	/*And Logs On From There*/
+	historyCheck(historyBoot(HISTORY_BOOTS + 2) == SYSCTRL_E_OK, "status after rebuild", SYSCTRL_E_NOT_OK, SYSCTRL_E_OK);
+	historyCheck(SysCtrl_resetHistoryCount() == 2, "entries after rebuild", SysCtrl_resetHistoryCount(), 2);
+
+	printf("reset history: %lu boots, %lu padding bytes scribbled, %lu failures\n", (unsigned long)HISTORY_BOOTS + 3, padding,
+	       g_failures);
+	return (g_failures == 0) ? 0 : 1;
+}
+
+/**********************************************************************************************************************
+ *  END OF FILE: SysCtrl_resetHistoryCheck.c
+ *********************************************************************************************************************/
@@ -0,0 +1,223 @@
+/******************************************************************************
+ *
+ * Module: System Control
+ *
+ * File Name: SysCtrl_snapshotDecode.c
+ *
+ * Description: Host Side Decoder For SysCtrl State Snapshots
+ * Reads one or more SysCtrl_snapshotType records (SysCtrl_captureState) back to back and
+ * prints every register field and gate. With -d only the fields that changed from the
+ * previous record are printed after the first one.
+ *
+ *   cc -o SysCtrl_snapshotDecode SysCtrl_snapshotDecode.c
+ *   ./SysCtrl_snapshotDecode [-d] snapshots.bin
+ *
+ * Author: Sayed Mohsen
+ *
+ *******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+
+/*Record Layout (SysCtrl_snapshot.h, version 1)*/
+#define SNAPSHOT_MAGIC_0     (0x53U)
+#define SNAPSHOT_MAGIC_1     (0x4EU)
+#define SNAPSHOT_VERSION     (1U)
+#define SNAPSHOT_SIZE        (92U)
+#define SNAPSHOT_REGS        (5U)
+#define SNAPSHOT_BLOCKS      (4U)
+#define SNAPSHOT_PERIPHRALS  (16U)
+#define SNAPSHOT_REG_OFS     (8U)
+#define SNAPSHOT_GATE_OFS    (SNAPSHOT_REG_OFS + (SNAPSHOT_REGS * 4U))
+
+/*Register Field*/
+typedef struct {
+	unsigned char reg;
+	const char *name;
+	unsigned char shift;
+	unsigned char width;
+}fieldType;
+
+static const char *const g_regName[SNAPSHOT_REGS] = { "RCC", "RCC2", "RIS", "PLLSTAT", "RESC" };
+
+static const char *const g_blockName[SNAPSHOT_BLOCKS] = { "RCGC", "SCGC", "DCGC", "PR" };
+
+static const char *const g_periphralName[SNAPSHOT_PERIPHRALS] =
+{
+	"WD", "TIMER", "GPIO", "DMA", "HIB", "UART", "SSI", "I2C",
+	"USB", "CAN", "ADC", "ACMP", "PWM", "QEI", "EEPROM", "WTIMER"
+};
+
+static const fieldType g_field[] =
+{
+	{0, "MOSCDIS", 0, 1},   {0, "OSCSRC", 4, 2},    {0, "XTAL", 6, 5},      {0, "BYPASS", 11, 1},
+	{0, "PWRDN", 13, 1},    {0, "PWMDIV", 17, 3},   {0, "USEPWMDIV", 20, 1}, {0, "USESYSDIV", 22, 1},
+	{0, "SYSDIV", 23, 4},   {0, "ACG", 27, 1},
+	{1, "OSCSRC2", 4, 3},   {1, "BYPASS2", 11, 1},  {1, "PWRDN2", 13, 1},   {1, "USBPWRDN", 14, 1},
+	{1, "SYSDIV2LSB", 22, 1}, {1, "SYSDIV2", 23, 6}, {1, "DIV400", 30, 1},  {1, "USERCC2", 31, 1},
+	{2, "MOFRIS", 3, 1},    {2, "PLLLRIS", 6, 1},   {2, "MOSCPUPRIS", 8, 1},
+	{3, "LOCK", 0, 1},
+	{4, "EXT", 0, 1},       {4, "POR", 1, 1},       {4, "BOR", 2, 1},       {4, "WDT0", 3, 1},
+	{4, "SW", 4, 1},        {4, "WDT1", 5, 1},      {4, "MOSCFAIL", 16, 1}
+};
+
+/*Crystal Frequencies In kHz Indexed By The XTAL Field*/
+static const unsigned long g_xtalKhz[32] =
+{
+	0, 0, 0, 0, 0, 0, 4000, 4096, 4915, 5000, 5120, 6000, 6144, 7373, 8000, 8192,
+	10000, 12000, 12288, 13560, 14318, 16000, 16384, 18000, 20000, 24000, 25000, 0, 0, 0, 0, 0
+};
+
+/*Little Endian 32 Bit Value*/
+static unsigned long readWord(const unsigned char *data_ptr)
+{
+	return (unsigned long)data_ptr[0] | ((unsigned long)data_ptr[1] << 8) |
+	       ((unsigned long)data_ptr[2] << 16) | ((unsigned long)data_ptr[3] << 24);
+}
+
+static unsigned long readReg(const unsigned char *record_ptr, unsigned int reg)
+{
+	return readWord(record_ptr + SNAPSHOT_REG_OFS + (reg * 4U));
+}
+
+static unsigned long fieldValue(const unsigned char *record_ptr, const fieldType *field_ptr)
+{
+	return (readReg(record_ptr, field_ptr->reg) >> field_ptr->shift) & ((1UL << field_ptr->width) - 1UL);
+}
+
+/*System Clock Decoded From RCC / RCC2 (0 -> PLL not locked)*/
+static unsigned long systemClockKhz(const unsigned char *record_ptr)
+{
+	unsigned long rcc = readReg(record_ptr, 0);
+	unsigned long rcc2 = readReg(record_ptr, 1);
+	unsigned long useRcc2 = rcc2 >> 31;
+	unsigned long source = useRcc2 ? ((rcc2 >> 4) & 7) : ((rcc >> 4) & 3);
+	unsigned long bypass = useRcc2 ? ((rcc2 >> 11) & 1) : ((rcc >> 11) & 1);
+	unsigned long divisor = useRcc2 ? (((rcc2 >> 23) & 0x3F) + 1) : (((rcc >> 23) & 0xF) + 1);
+	unsigned long clock;
+
+	if (!bypass)
+	{
+		if (readReg(record_ptr, 3) == 0)
+		{
+			return 0;
+		}
+		if (useRcc2 && ((rcc2 >> 30) & 1))
+		{
+			return 400000UL / (((rcc2 >> 22) & 0x7F) + 1);
+		}
+		return 200000UL / divisor;
+	}
+
+	clock = (source == 0) ? g_xtalKhz[(rcc >> 6) & 0x1F] : (source == 1) ? 16000 : (source == 2) ? 4000 :
+	        (source == 3) ? 30 : 33;
+	return ((rcc >> 22) & 1) ? (clock / divisor) : clock;
+}
+
+static void printGates(const unsigned char *record_ptr, const unsigned char *previous_ptr)
+{
+	unsigned int block, periphral, instance;
+	unsigned char gates;
+
+	for (block = 0; block < SNAPSHOT_BLOCKS; block++)
+	{
+		for (periphral = 0; periphral < SNAPSHOT_PERIPHRALS; periphral++)
+		{
+			gates = record_ptr[SNAPSHOT_GATE_OFS + (block * SNAPSHOT_PERIPHRALS) + periphral];
+			if ((previous_ptr != NULL) && (gates == previous_ptr[SNAPSHOT_GATE_OFS + (block * SNAPSHOT_PERIPHRALS) + periphral]))
+			{
+				continue;
+			}
+			if ((previous_ptr == NULL) && (gates == 0))
+			{
+				continue;
+			}
+			printf("  %-4s %-7s", g_blockName[block], g_periphralName[periphral]);
+			for (instance = 0; instance < 8; instance++)
+			{
+				if (gates & (1U << instance))
+				{
+					printf(" %u", instance);
+				}
+			}
+			printf("%s\n", (gates == 0) ? " -" : "");
+		}
+	}
+}
+
+static void printRecord(unsigned long index, const unsigned char *record_ptr, const unsigned char *previous_ptr)
+{
+	unsigned int field, reg;
+
+	printf("snapshot %lu  cycles %lu  system clock %lu kHz\n", index, readWord(record_ptr + 4), systemClockKhz(record_ptr));
+	for (reg = 0; reg < SNAPSHOT_REGS; reg++)
+	{
+		if ((previous_ptr != NULL) && (readReg(record_ptr, reg) == readReg(previous_ptr, reg)))
+		{
+			continue;
+		}
+		printf("  %-7s 0x%08lx", g_regName[reg], readReg(record_ptr, reg));
+		for (field = 0; field < (sizeof(g_field) / sizeof(g_field[0])); field++)
+		{
+			if ((g_field[field].reg != reg) ||
+			    ((previous_ptr != NULL) && (fieldValue(record_ptr, &g_field[field]) == fieldValue(previous_ptr, &g_field[field]))))
+			{
+				continue;
+			}
+			printf(" %s=%lu", g_field[field].name, fieldValue(record_ptr, &g_field[field]));
+			if ((reg == 0) && (g_field[field].shift == 6))
+			{
+				printf("(%lukHz)", g_xtalKhz[fieldValue(record_ptr, &g_field[field])]);
+			}
+		}
+		printf("\n");
+	}
+	printGates(record_ptr, previous_ptr);
+}
+
+int main(int argc, char *argv[])
+{
+	unsigned char record[SNAPSHOT_SIZE];
+	unsigned char previous[SNAPSHOT_SIZE];
+	unsigned long index = 0;
+	int diffOnly = 0;
+	const char *path;
+	FILE *file;
+
+	if ((argc == 3) && (strcmp(argv[1], "-d") == 0))
+	{
+		diffOnly = 1;
+	}
+	else if (argc != 2)
+	{
+		fprintf(stderr, "usage: %s [-d] snapshots.bin\n", argv[0]);
+		return 1;
+	}
+	path = argv[argc - 1];
+
+	file = fopen(path, "rb");
+	if (file == NULL)
+	{
+		perror(path);
+		return 1;
+	}
+
+	while (fread(record, 1, sizeof(record), file) == sizeof(record))
+	{
+		if ((record[0] != SNAPSHOT_MAGIC_0) || (record[1] != SNAPSHOT_MAGIC_1) ||
+		    (record[2] != SNAPSHOT_VERSION) || (record[3] != SNAPSHOT_SIZE))
+		{
+			fprintf(stderr, "%s: record %lu is not a version %u snapshot\n", path, index, SNAPSHOT_VERSION);
+			fclose(file);
+			return 1;
+		}
+		printRecord(index, record, (diffOnly && (index != 0)) ? previous : NULL);
+		memcpy(previous, record, sizeof(record));
+		index++;
+	}
+	fclose(file);
+	return 0;
+}
+
+/**********************************************************************************************************************
+ *  END OF FILE: SysCtrl_snapshotDecode.c
+ *********************************************************************************************************************/
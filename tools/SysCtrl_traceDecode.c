@@ -0,0 +1,194 @@
+/******************************************************************************
+ *
+ * Module: System Control
+ *
+ * File Name: SysCtrl_traceDecode.c
+ *
+ * Description: Host Side Decoder For SysCtrl Trace Dumps
+ * Reads a raw dump of SysCtrl_traceBufferType (SysCtrl_traceGetBuffer) and prints the
+ * records oldest first as a timeline. Dumps from the 32 bit target and from a 64 bit
+ * host simulator build are both accepted.
+ *
+ *   cc -o SysCtrl_traceDecode SysCtrl_traceDecode.c
+ *   ./SysCtrl_traceDecode trace.bin [coreClockHz]
+ *
+ * Author: Sayed Mohsen
+ *
+ *******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+
+/*Trace Buffer Signature ("SCTR")*/
+#define TRACE_MAGIC        (0x52544353UL)
+
+/*Largest Dump Accepted*/
+#define TRACE_MAX_BYTES    (1UL << 20)
+
+static const char *const g_eventName[] =
+{
+	"?",
+	"CLOCK_SOURCE_SET",
+	"PLL_POWER_UP",
+	"PLL_LOCKED",
+	"BYPASS_REMOVED",
+	"CLOCK_FALLBACK",
+	"GATE_ENABLE",
+	"GATE_DISABLE",
+	"PERIPHERAL_READY",
+	"SLEEP",
+	"WAKE",
+	"MOSC_FAILURE",
+	"SHADOW_MISMATCH",
+	"PIOSC_TRIM",
+	"RESET_ASSERT",
+	"RESET_RELEASE"
+};
+
+static const char *const g_periphralName[] =
+{
+	"WD", "TIMER", "GPIO", "DMA", "HIB", "UART", "SSI", "I2C",
+	"USB", "CAN", "ADC", "ACMP", "PWM", "QEI", "EEPROM", "WTIMER"
+};
+
+static const char *const g_sourceName[] =
+{
+	"MOSC", "PIOSC", "PIOSC/4", "LFIOSC", "?", "?", "?", "32.768kHz"
+};
+
+/*Little Endian Field Of 2, 4 Or 8 Bytes*/
+static unsigned long long readField(const unsigned char *data_ptr, unsigned int size)
+{
+	unsigned long long value = 0;
+
+	while (size-- != 0)
+	{
+		value = (value << 8) | data_ptr[size];
+	}
+	return value;
+}
+
+int main(int argc, char *argv[])
+{
+	static unsigned char dump[TRACE_MAX_BYTES];
+	unsigned long long depth, head, count, index, first;
+	unsigned long long timestamp, value, start = 0, previous = 0;
+	unsigned int word, recordSize, event, param;
+	double coreClock = 0.0;
+	const unsigned char *record_ptr;
+	size_t length;
+	FILE *file;
+
+	if (argc < 2)
+	{
+		fprintf(stderr, "usage: %s trace.bin [coreClockHz]\n", argv[0]);
+		return 1;
+	}
+	if (argc > 2)
+	{
+		coreClock = atof(argv[2]);
+	}
+
+	file = fopen(argv[1], "rb");
+	if (file == NULL)
+	{
+		perror(argv[1]);
+		return 1;
+	}
+	length = fread(dump, 1, sizeof(dump), file);
+	fclose(file);
+
+	/*unsigned long Is 4 Bytes On The Target, 8 On A 64 Bit Host*/
+	if ((length < 8) || (readField(dump, 4) != TRACE_MAGIC))
+	{
+		fprintf(stderr, "%s: not a SysCtrl trace dump\n", argv[1]);
+		return 1;
+	}
+	word = (readField(dump + 4, 4) == 0) ? 8 : 4;
+	recordSize = (word == 8) ? 24 : 12;
+
+	depth = readField(dump + word, word);
+	head = readField(dump + (2 * word), word);
+	if ((depth == 0) || (length < ((3 * word) + (depth * recordSize))))
+	{
+		fprintf(stderr, "%s: truncated dump\n", argv[1]);
+		return 1;
+	}
+
+	count = (head < depth) ? head : depth;
+	first = head - count;
+	printf("%llu records (%llu written, %llu lost)\n", count, head, first);
+	printf("%5s %12s %10s %10s  %-18s %s\n", "#", "cycles", "+cycles", coreClock ? "+us" : "", "event", "detail");
+
+	for (index = first; index < head; index++)
+	{
+		record_ptr = dump + (3 * word) + ((index % depth) * recordSize);
+		timestamp = readField(record_ptr, word);
+		event = (unsigned int)readField(record_ptr + word, 2);
+		param = (unsigned int)readField(record_ptr + word + 2, 2);
+		value = readField(record_ptr + ((word == 8) ? 16 : 8), word);
+
+		if (index == first)
+		{
+			start = timestamp;
+			previous = timestamp;
+		}
+
+		printf("%5llu %12llu %10llu ", index, timestamp - start, timestamp - previous);
+		if (coreClock)
+		{
+			printf("%10.2f  ", ((double)(timestamp - previous) * 1e6) / coreClock);
+		}
+		else
+		{
+			printf("%10s  ", "");
+		}
+		printf("%-18s ", g_eventName[(event < (sizeof(g_eventName) / sizeof(g_eventName[0]))) ? event : 0]);
+
+		switch (event)
+		{
+		case 1:
+			printf("%s rcc2=0x%08llx", g_sourceName[param & 7], value);
+			break;
+		case 2:
+			printf("attempt %u", param);
+			break;
+		case 3:
+			printf("%llu cycles", value);
+			break;
+		case 4:
+		case 5:
+		case 11:
+			printf("%llu Hz", value);
+			break;
+		case 6:
+		case 7:
+		case 8:
+		case 14:
+		case 15:
+			printf("%s mask 0x%llx", (param < 16) ? g_periphralName[param] : "?", value);
+			break;
+		case 9:
+			printf("%s", param ? "deep-sleep" : "sleep");
+			break;
+		case 10:
+			printf("%llu cycles", value);
+			break;
+		case 12:
+			printf("offset 0x%03x hw=0x%08llx", param, value);
+			break;
+		case 13:
+			printf("trim %u %llu Hz", param, value);
+			break;
+		default:
+			printf("param %u value %llu", param, value);
+			break;
+		}
+		printf("\n");
+		previous = timestamp;
+	}
+	return 0;
+}
+
+/**********************************************************************************************************************
+ *  END OF FILE: SysCtrl_traceDecode.c
+ *********************************************************************************************************************/